@@ -0,0 +1,58 @@
+#ifndef __BITBASES__
+
+#include <string>
+
+//******************************************************************************
+// Bitbases - exact results for the simplest endings, ie, king and pawn, rook
+// or queen versus lone king (KPK, KRK, KQK).
+//
+// tables are generated by retrograde analysis, or are loaded (memory mapped)
+// from a cache file. each entry is indexed by side to move, and the squares of
+// the strong sides king, the strong sides piece and the lone king. an entry
+// holds the # of plies to mate (plus one), or zero for a draw...
+//******************************************************************************
+
+namespace SeaChess {
+
+class Board;
+
+class Bitbases {
+public:
+  enum ENDINGS { KPK=0, KRK, KQK, NUM_ENDINGS };
+
+  enum { ENTRIES = 2 * 64 * 64 * 64 }; // side to move x strong king x piece x lone king
+
+  enum PROBE_RESULT { DRAW_RESULT=0, WIN_RESULT, LOSS_RESULT };
+
+  // generate tables, or load them from cache file (and if the cache file does not
+  // exist, create it)...
+
+  static void Init(std::string cache_file = "");
+
+  static bool Ready() { return tables[KPK] != NULL; };
+
+  // for a board position with color to move, is the result known? if so, result is from
+  // color-to-move's point of view; plies is the # of plies to mate (when not a draw)...
+
+  static bool Probe(int &result, int &plies, Board &board, int color);
+
+  // # of (legal) positions won, drawn, for some ending, strong side to move...
+
+  static void Stats(int &wins, int &draws, int ending);
+
+private:
+  static void Generate(unsigned char *table, int piece_type, unsigned char *promotions_table = NULL);
+
+  static bool Load(std::string cache_file);
+  static void Save(std::string cache_file);
+
+  static unsigned char *tables[NUM_ENDINGS];
+  static unsigned char *table_storage;  // generated tables, or
+  static void *cache_map;               //   memory mapped cache file
+  static size_t cache_size;
+};
+
+};
+
+#endif
+#define __BITBASES__
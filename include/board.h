@@ -9,6 +9,8 @@
 //***********************************************************************************
 
 namespace SeaChess {
+
+#define BOARD_PACKED_BYTES 67  // saved board state - 64 squares, en passant row, column, color
   
 class Board {
 public:
@@ -50,6 +52,12 @@ public:
     return (_board[row][column] != 0);
   };
 
+  // piece on a square, as color << 4 | piece type, zero if none...
+
+  int SquareContents(int row, int column) {
+    return _board[row][column] & 0x3f;
+  };
+
   // top bit of square used to indicate piece is at initial placement...
   
   bool InitialPosition(int row, int column) {
@@ -154,19 +162,11 @@ public:
     throw std::logic_error("Wheres the " + ColorAsStr(color) + "king???");    
   };
 
-  int PieceCount(int color) {
-    int pc = 0;
-    int ptype, pcolor;
-    for (auto i = 0; i < 8; i++)
-       for (auto j = 0; j < 8; j++)
-          if (GetPiece(ptype,pcolor,i,j) && (pcolor == color) ) pc++;
+  // piece counts - for a side (all pieces, or other than king and pawns), or both sides...
 
-    return pc;
-  };
-
-  int TotalPieceCount() {
-    return PieceCount(WHITE) + PieceCount(BLACK);
-  };
+  int PieceCount(int color) { return piece_count(*this,color); };
+  int TotalPieceCount() { return piece_count(*this,NOT_SET); };
+  int NonPawnPieceCount(int color) { return non_pawn_piece_count(*this,color); };
 
   void GetOpposingKing(int &row,int &column,int color) {
     int opposing_color = (color==WHITE) ? BLACK : WHITE;
@@ -222,12 +222,35 @@ public:
     return NOT_SET;
   }
 
+  // is a square attacked by any piece of some color? the search works outward from the
+  // square, thus the cost does not depend on the # of pieces on the board...
+
+  bool IsSquareAttacked(int row, int column, int by_color);
+
+  // the squares, row by row (square index is row * 8 + column)...
+
+  const unsigned char *Squares() { return &_board[0][0]; };
+
+  // kernels (see CpuFeatures) - piece counts. the scalar variants work square by square; the
+  // others count the bits of masks of the squares (one bit per square) built with vector compares.
+  // the attack test stays scalar - it looks at few squares, fewer than a mask of the board costs...
+
+  static void SelectKernels(int path);
+
+  static int  (*piece_count)(Board &board, int color);  // color NOT_SET - both sides
+  static int  (*non_pawn_piece_count)(Board &board, int color);
+
   friend std::ostream& operator<< (std::ostream &os, Board &fld);
 
   // save or load board state to/from stream...
   
   void Save(std::ofstream &saveFile);
   void Load(std::ifstream &loadFile);
+
+  // same, to/from a buffer of BOARD_PACKED_BYTES bytes (squares, then en passant square, color)...
+
+  void Pack(unsigned char *tbuf);
+  void Unpack(const unsigned char *tbuf);
   
 protected:
   void MakeMoveInner(int start_row, int start_column, int end_row, int end_column,
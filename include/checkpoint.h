@@ -0,0 +1,106 @@
+#ifndef __CHECKPOINT__
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+//******************************************************************************
+// Checkpoint - versioned, checksummed save file: game state and history, and
+// (optionally) the monte-carlo tree from the engines last search. the tree is
+// kept as a flat array of fixed size nodes, breadth first, so that a nodes
+// children are adjacent. a checkpoint is read via mmap; the tree is used in
+// place (nodes are only added to the search tree as the search reaches them).
+//
+// layout: header, game section, tree section (8 byte aligned). the checksum
+// (64 bit FNV-1a) covers everything after the header. multi-byte values are
+// in host byte order...
+//******************************************************************************
+
+namespace SeaChess {
+
+#define CHECKPOINT_MAGIC   "SEACHKPT"
+#define CHECKPOINT_VERSION 1
+
+struct CheckpointHeader {
+  char     magic[8];
+  uint32_t version;
+  uint32_t header_bytes;      // sizeof(CheckpointHeader)
+  uint64_t game_offset;       // game section,
+  uint64_t game_bytes;        //   size in bytes
+  uint64_t tree_offset;       // tree section,
+  uint32_t tree_count;        //   # of nodes,
+  uint32_t tree_node_bytes;   //   sizeof(CheckpointNode)
+  uint64_t checksum;          // FNV-1a, all bytes after the header
+};
+
+// a monte-carlo tree node. the root (index zero) has no move...
+
+struct CheckpointNode {
+  uint32_t first_child;       // index of first child
+  uint16_t num_children;
+  uint16_t move;              // color << 12 | start square << 6 | end square
+  uint32_t visits;
+  float    white_wins;
+  float    black_wins;
+  uint32_t amaf_visits;
+  float    amaf_wins;
+  uint8_t  outcome;
+  uint8_t  unused[3];
+};
+
+// game state, as saved/restored by the engine...
+
+struct CheckpointGame {
+  CheckpointGame() : color(0), levels(0), num_moves(0), num_turns(0), debug(false), tree_color(0) {};
+
+  unsigned char color;
+  Board         board;
+  unsigned int  levels;
+  unsigned int  num_moves;
+  unsigned int  num_turns;
+  bool          debug;
+  std::string   debug_move_trigger;
+  GameHistory   history;
+
+  Board         tree_board;   // position at the root of the tree (if any),
+  unsigned char tree_color;   //   and color to move
+};
+
+class Checkpoint {
+public:
+  Checkpoint() : base(NULL), size(0), tree(NULL), tree_count(0) {};
+  ~Checkpoint() { Close(); };
+
+  // write checkpoint file. tree may be NULL...
+
+  static void Write(std::string file, CheckpointGame &game, const CheckpointNode *tree, uint32_t tree_count);
+
+  // map checkpoint file. returns false if the file is not a checkpoint (ie, some older save file
+  // format); throws if the file is a checkpoint but is truncated, corrupt or of a later version...
+
+  bool Open(std::string file, CheckpointGame &game);
+  void Close();
+
+  const CheckpointNode *Tree() { return tree; };
+  uint32_t TreeCount() { return tree_count; };
+
+  // find a position (board, color to move) in the tree, within max_plies of the root. returns the
+  // nodes index, or -1 if not found...
+
+  static int FindPosition(const CheckpointNode *tree, uint32_t tree_count, Board &tree_board, int tree_color,
+                          Board &board, int color, int max_plies = 2);
+
+  static uint64_t Checksum(const unsigned char *bytes, size_t count);
+
+private:
+  unsigned char *base;        // mapped file
+  size_t size;
+
+  const CheckpointNode *tree; // tree section (in the mapped file)
+  uint32_t tree_count;
+};
+
+};
+
+#endif
+#define __CHECKPOINT__
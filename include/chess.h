@@ -13,10 +13,27 @@ namespace SeaChess {
 #include <stdexcept>
 #include <assert.h>
 #include <chess_utils.h>
+#include <logger.h>
+#include <cpu_features.h>
+#include <profiler.h>
 #include <board.h>
 #include <move.h>
+#include <move_list.h>
 #include <pieces.h>
+#include <move_generator.h>
+#include <zobrist.h>
+#include <game_history.h>
+#include <checkpoint.h>
+#include <tree_dump.h>
+#include <opening_book.h>
+#include <bitbases.h>
+#include <search_stats.h>
+#include <search_control.h>
+#include <transposition_table.h>
+#include <evaluator.h>
+#include <nnue.h>
 #include <moves_tree.h>
+#include <mate_solver.h>
 #include <engine.h>
 
 #endif
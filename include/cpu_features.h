@@ -0,0 +1,64 @@
+#ifndef __CPU_FEATURES__
+
+#include <string>
+#include <stdint.h>
+
+//******************************************************************************
+// CpuFeatures - what the host CPU offers (cpuid), and which build of the
+// engines kernels is used. the kernels - board square masks (piece
+// counts), NNUE layers, UCB1 selection - are built in several variants,
+// each for an instruction set; one binary runs on any x86-64 host, using the
+// best variant the host supports:
+//
+//   avx2   - AVX2, BMI1, LZCNT, POPCNT (haswell on)
+//   ssse3  - SSSE3, POPCNT (nehalem on)
+//   scalar - plain C++ (the original mailbox code for the board kernels)
+//
+// every variant gives the same results, ie, the same search. a variant is
+// chosen at startup (see Select), before any search...
+//******************************************************************************
+
+namespace SeaChess {
+
+enum KERNELS_PATH { KERNELS_SCALAR=0, KERNELS_SSSE3, KERNELS_AVX2 };
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_FEATURES_X86 1
+#define KERNELS_TARGET_SSSE3 __attribute__((target("ssse3,popcnt")))
+#define KERNELS_TARGET_AVX2  __attribute__((target("avx2,bmi,lzcnt,popcnt")))
+#endif
+
+class CpuFeatures {
+public:
+  // detect host features (once; cached)...
+
+  static void Detect();
+
+  // does the host support a kernels path? best path it supports...
+
+  static bool Supported(int path);
+  static int Best();
+
+  // select kernels path - "auto" (the best supported), or by name. throws logic_error if the host
+  // does not support the path asked for...
+
+  static void Select(std::string path_name);
+
+  static int Path() { return path; };
+  static const char *PathName(int _path);
+
+  // host features, as a list of names ("popcnt bmi1 ..."); none - "none"...
+
+  static std::string Summary();
+
+  static bool popcnt, lzcnt, bmi1, bmi2, ssse3, avx2, avx512bw;
+
+private:
+  static bool detected;
+  static int path;
+};
+
+};
+
+#endif
+#define __CPU_FEATURES__
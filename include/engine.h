@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <memory>
 #include <iostream>
 #include <fstream>
 #include <sys/time.h>
@@ -16,14 +17,24 @@ namespace SeaChess {
 
 enum ALGORITHMS { MINIMAX=0, RANDOM, MONTE_CARLO };
 
+#define MATE_SEARCH_MOVES 4  // by default, look for forced mates up to this # of moves before searching
+#define MATE_SEARCH_TIME_SHARE 10  // percent of the (soft) time limit the mate search may use
+
 class Engine {
  public:
-  Engine() : algorithm_index(MINIMAX) {};
+  Engine() : algorithm_index(MINIMAX), null_move_pruning(true), late_move_reductions(true), futility_pruning(true),
+             rave(false), mcts_memory(0), mcts_games(0), rollout_count(1), rollout_pool(NULL),
+             mate_search_moves(MATE_SEARCH_MOVES), post_thinking(false), uci_mode(false), search_levels(0),
+             search_tree_color(WHITE), resume_search_tree(false), book_depth(0) {};
   Engine(int _num_levels,std::string _debug_enable_str, std::string _opening_moves_str,
-	 std::string _load_file, unsigned int _move_time, std::string _algorithm) : algorithm_index(MINIMAX) {
+	 std::string _load_file, unsigned int _move_time, std::string _algorithm)
+    : algorithm_index(MINIMAX), null_move_pruning(true), late_move_reductions(true), futility_pruning(true),
+      rave(false), mcts_memory(0), mcts_games(0), rollout_count(1), rollout_pool(NULL),
+      mate_search_moves(MATE_SEARCH_MOVES), post_thinking(false), uci_mode(false), search_levels(0),
+      search_tree_color(WHITE), resume_search_tree(false), book_depth(0) {
     Init(_num_levels,_debug_enable_str,_opening_moves_str,_load_file, _move_time, _algorithm);
   };
-  ~Engine() {};
+  ~Engine();
 
   void Init(int _num_levels,std::string _debug_enable_str, std::string _opening_moves_str,
 	    std::string _load_file, unsigned int _move_time, std::string algorithm);
@@ -33,8 +44,13 @@ class Engine {
   virtual void NewGame() {
     color = BLACK;
     game_board.Setup();
+    game_history.Clear();
+    game_history.Push(game_board,WHITE,true);
     num_moves = 0;
     num_turns = 0;
+    search_tree.clear();
+    resume_search_tree = false;
+    checkpoint.Close();
     UserSetsOpening();
   };
 
@@ -60,16 +76,126 @@ class Engine {
   
   std::string UserMove(std::string opponents_move);
 
+  // UCI - the game is set up (from the start position) move by move; the engine plays whichever
+  // side is to move. there are no built-in opening moves (a book, if any, is still used), a draw
+  // by rule is left to the GUI, and thinking output is sent as 'info' lines...
+
+  void SetUciMode(bool _uci_mode) { uci_mode = _uci_mode; };
+
+  void NewPosition() {
+    NewGame();
+    color = WHITE;
+    ClearOpeningMoves();
+  };
+
+  // the side to move makes a move (as with UserMove, an error message is returned if the move is
+  // not legal)...
+
+  std::string PlayMove(std::string move_str);
+
+  // move chosen by the last NextMove, in coordinates (plus 'q' for a promotion), even if it was
+  // not made (ie, it mates); empty if there was none...
+
+  std::string LastMove() { return last_move; };
+
+  // limits for the next search (UCI 'go'): depth (zero - as set at startup), time limits in
+  // milliseconds (see SearchControl). while searching, the search may be stopped or the
+  // ponder move hit, from another thread...
+
+  void SetSearchLimits(unsigned int depth, long soft_ms, long hard_ms, bool infinite, bool ponder);
+
+  void StopSearch() { search_control.Stop(); };
+  void PonderHit() { search_control.PonderHit(); };
+
   // display the game board, current state...
   
   void ShowBoard() {
-    std::cout << "# game board:\n" << game_board << std::endl;
+    Output() << "# game board:\n" << game_board << std::endl;
   };
 
+  // save/load game state, and the monte-carlo tree from the last search (see Checkpoint). older
+  // save files (game state only) can still be loaded...
+
   void Save(std::string saveFile);
   void Load(std::string loadFile);
 
   void SetDebug(bool _debug) { engine_debug = _debug; };
+
+  // minimax selective search features can be toggled...
+  
+  void SetSelectiveSearch(bool _null_move_pruning, bool _late_move_reductions, bool _futility_pruning) {
+    null_move_pruning    = _null_move_pruning;
+    late_move_reductions = _late_move_reductions;
+    futility_pruning     = _futility_pruning;
+  };
+
+  // monte-carlo RAVE (all-moves-as-first) move selection...
+
+  void SetRave(bool _rave) { rave = _rave; };
+
+  // monte-carlo tree memory budget, in megabytes (zero - no limit)...
+
+  void SetMctsMemory(unsigned int _mcts_memory) { mcts_memory = _mcts_memory; };
+
+  // monte-carlo max # of random games per move (zero - no limit)...
+
+  void SetMctsGames(unsigned int _mcts_games) { mcts_games = _mcts_games; };
+
+  // monte-carlo rollouts - # of random games played from each new leaf, and the # of threads
+  // to play them (the worker threads are started here, and kept 'til the engine exits). the
+  // games may also be shared out to worker processes (see MctsWorkers), at these addresses...
+
+  void SetRollouts(unsigned int _rollout_count, unsigned int rollout_threads,
+                   std::vector<std::string> worker_addresses = std::vector<std::string>());
+
+  // before each (minimax or monte-carlo) search, look for a forced mate in up to this # of
+  // moves (zero - don't)...
+
+  void SetMateSearch(unsigned int _mate_search_moves) { mate_search_moves = _mate_search_moves; };
+
+  // xboard 'post'/'nopost' - show (or not) thinking output while searching...
+  
+  void SetPostThinking(bool _post_thinking) { post_thinking = _post_thinking; };
+
+  // append each searchs stats (one JSON object per line) to this file...
+
+  void SetStatsFile(std::string _stats_file) { stats_file = _stats_file; };
+
+  SearchStats &LastSearchStats() { return search_stats; };
+
+  // opening book (polyglot format) replaces built-in opening moves. book moves are
+  // made for (at most) the first _book_depth engine moves...
+
+  void SetOpeningBook(std::string book_file, unsigned int _book_depth) {
+    opening_book = std::make_shared<OpeningBook>();
+    opening_book->Open(book_file);
+    book_depth = _book_depth;
+  };
+
+  // transposition table (minimax only). kept from one search, and game, to the next; may be
+  // shared with other engines...
+
+  void SetTranspositionTable(std::shared_ptr<TranspositionTable> table) { transposition_table = table; };
+
+  // evaluate positions with a neural network (minimax only). the network is read only, thus may
+  // be shared with other engines...
+
+  void SetNnueNetwork(std::shared_ptr<NnueNetwork> network) {
+    nnue_network = network;
+    nnue_evaluator.reset(new NnueEvaluator(network));
+  };
+
+  // after each search, append its tree to this (open) dump. may be shared with other engines...
+
+  void SetTreeDump(std::shared_ptr<TreeDump> _tree_dump) { tree_dump = _tree_dump; };
+
+  // use an (already open) book, shared with other engines (server mode). books are read only...
+
+  void SetOpeningBook(std::shared_ptr<OpeningBook> book, unsigned int _book_depth) {
+    opening_book = book;
+    book_depth = _book_depth;
+  };
+
   bool Debug() { return engine_debug; };
   
   // encode move in algebraic notation...
@@ -93,11 +219,37 @@ protected:
   
   void ChooseOpening(std::string first_move);
 
+  // no (more) standard opening moves...
+
+  void ClearOpeningMoves();
+
   // retreive next opening move...
   std::string NextOpeningMove();
 
+  // choose move from opening book, if there is one...
+  bool BookMove(Move &book_move);
+
   std::string NextMoveAsString(Move *next_move);
 
+  // validate, then make move for mover_color...
+
+  std::string ApplyMove(std::string move_str, int mover_color);
+
+  // look for forced mate; if there is one, return the first move...
+
+  bool MateSearch(Move &mating_move, Board &game_board);
+
+  // report search stats...
+
+  void ReportSearchStats();
+
+  // load save file written before checkpoints...
+
+  void LoadPreCheckpoint(std::string loadFile);
+
+  // why is the game drawn?...
+  std::string DrawReason();
+
   // print move details...
   
   void ShowMove(std::string title, Board &board, Move *pv) {
@@ -105,13 +257,13 @@ protected:
     if ( !board.GetPiece(type,color,pv->StartRow(),pv->StartColumn()) )
       std::runtime_error("ShowMove: no piece at start location!");
   
-    std::cout << title << "move " << ColorAsStr(color) << " "
+    Output() << title << "move " << ColorAsStr(color) << " "
 	    << PieceName(type) << " from "
 	    << board.Coordinates(pv->StartRow(),pv->StartColumn())
             << " (" << pv->StartRow() << "/" << pv->StartColumn() << ")"
 	    << " to " << board.Coordinates(pv->EndRow(),pv->EndColumn())
 	    << " (" << pv->EndRow() << "/" << pv->EndColumn() << ")";
-    std::cout << std::endl;
+    Output() << std::endl;
   };
 
   // user has some control over debug prints...
@@ -156,6 +308,7 @@ protected:
  private:
   unsigned char color;                     // color assigned to engine
   Board         game_board;                // the game board
+  GameHistory   game_history;              // positions reached, for repetition/fifty move draws
   unsigned int  number_of_levels;          // how many levels to look ahead
   unsigned int  num_moves;                 // # of moves examined for each play by the engine
   unsigned int  num_turns;                 // # of turns in a game (i move, then you move...)
@@ -171,7 +324,42 @@ protected:
 
   bool have_opening_moves;                 // set to true once opening moves have been set
 
+  bool null_move_pruning;                  //
+  bool late_move_reductions;               // minimax selective search features
+  bool futility_pruning;                   //
+
+  bool rave;                               // monte-carlo RAVE move selection
+  unsigned int mcts_memory;                // monte-carlo tree memory budget, in MB
+  unsigned int mcts_games;                 // monte-carlo max random games per move
+  unsigned int rollout_count;              // monte-carlo random games per leaf,
+  RolloutPool *rollout_pool;               //   and threads (and worker processes) to play them
+
+  unsigned int mate_search_moves;          // mate solver depth, in moves
+
+  bool post_thinking;                      // xboard 'post' mode
+
+  bool uci_mode;                           // driven by UCI (see SetUciMode)
+  SearchControl search_control;            // search limits (UCI 'go'), stop
+  unsigned int search_levels;              // (minimax) depth for the next search; zero - number_of_levels
+  std::string last_move;                   // see LastMove
+
+  SearchStats search_stats;                // stats from the last search,
+  std::string stats_file;                  //   optionally logged to this file
+
+  std::vector<CheckpointNode> search_tree; // monte-carlo tree from the last search (flat form),
+  Board search_tree_board;                 //   position at its root,
+  unsigned char search_tree_color;         //   color to move
+  Checkpoint checkpoint;                   // loaded checkpoint; its tree (if any) is used
+  bool resume_search_tree;                 //   when next searching (if the position is in it)
+
   std::queue<std::string> opening_moves;   // 'machine side' opening moves
+
+  std::shared_ptr<OpeningBook> opening_book; // optional opening book
+  std::shared_ptr<TranspositionTable> transposition_table; // optional (minimax) transposition table
+  std::shared_ptr<NnueNetwork> nnue_network;          // optional (minimax) neural network evaluation,
+  std::unique_ptr<NnueEvaluator> nnue_evaluator;      //   its accumulators
+  std::shared_ptr<TreeDump> tree_dump;     // search trees written here (optional)
+  unsigned int book_depth;                 // max # of engine moves to take from book
 };
 
 };
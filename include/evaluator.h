@@ -0,0 +1,40 @@
+#ifndef __EVALUATOR__
+
+//******************************************************************************
+// Evaluator - plug-in position evaluation for the search. without one, the
+// search uses the classic (material and piece-square tables) evaluation, see
+// MovesTree::MaterialScore.
+//
+// the search tells the evaluator about each move it makes and takes back, so
+// an evaluator may keep state incrementally, from the search root on...
+//******************************************************************************
+
+namespace SeaChess {
+
+class Board;
+
+class Evaluator {
+public:
+  virtual ~Evaluator() {};
+
+  virtual const char *Name() = 0;
+
+  // start of a search, from this position...
+
+  virtual void SetRoot(Board &board) = 0;
+
+  // move made, from board (the current position) to updated_board; move taken back...
+
+  virtual void Push(Board &board, Board &updated_board) = 0;
+  virtual void Pop() = 0;
+
+  // score of a position - the current position, or one reached from it by a move that has not
+  // been pushed - from the point of view of color (side to move)...
+
+  virtual int Evaluate(Board &board, int color) = 0;
+};
+
+};
+
+#endif
+#define __EVALUATOR__
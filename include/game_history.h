@@ -0,0 +1,85 @@
+#ifndef __GAME_HISTORY__
+
+#include <vector>
+#include <stdint.h>
+
+//******************************************************************************
+// GameHistory - stack of (zobrist) keys for the positions reached in a game,
+// each with its halfmove clock, ie, # of plies since the last capture or pawn
+// move. positions are pushed as moves are made (in the game itself, and during
+// search or random games) and popped as they are taken back...
+//******************************************************************************
+
+namespace SeaChess {
+
+class Board;
+class Move;
+
+class GameHistory {
+public:
+  GameHistory() {};
+
+  void Clear() { entries.clear(); };
+
+  int Count() { return entries.size(); };
+
+  // record position reached, ie, the board after a move, with color to move. irreversible - the
+  // move was a capture or pawn move. a null move (search only) is not a real move, so no earlier
+  // position is considered to recur across it, but the halfmove clock keeps counting...
+
+  void Push(Board &board, int color_to_move, bool irreversible, bool null_move = false);
+
+  // same, for a move made from the current position. the key is updated incrementally (board is
+  // the board before the move, updated_board the board after)...
+
+  void Push(Board &board, Move *move, Board &updated_board, int color_to_move);
+
+  void Pop() { entries.pop_back(); };
+
+  // key of the current position...
+
+  uint64_t Key() { return entries.back().key; };
+
+  // has the current position occurred (at least) 'count' times before?...
+
+  bool Repetition(int count = 1);
+
+  // no capture or pawn move in the last fifty moves (by each side)?...
+
+  bool FiftyMoves() { return !entries.empty() && (entries.back().halfmove_clock >= 100); };
+
+  // within search or random games, any repetition is scored as a draw...
+
+  bool Draw() { return FiftyMoves() || Repetition(1); };
+
+  // does a move (not yet made) capture or move a pawn?...
+
+  static bool Irreversible(Board &board, Move *move);
+
+  // entries, as saved/restored (see Checkpoint)...
+
+  void GetEntry(int index, uint64_t &key, int &halfmove_clock, int &window) {
+    key = entries[index].key;
+    halfmove_clock = entries[index].halfmove_clock;
+    window = entries[index].window;
+  };
+
+  void AddEntry(uint64_t key, int halfmove_clock, int window) {
+    Entry entry = { key, halfmove_clock, window };
+    entries.push_back(entry);
+  };
+
+private:
+  struct Entry {
+    uint64_t key;
+    int halfmove_clock;  // plies since capture or pawn move
+    int window;          // plies since capture, pawn move or null move
+  };
+
+  std::vector<Entry> entries;
+};
+
+};
+
+#endif
+#define __GAME_HISTORY__
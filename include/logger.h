@@ -0,0 +1,100 @@
+#ifndef __LOGGER__
+
+#include <string>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdio.h>
+
+//******************************************************************************
+// Logger - leveled diagnostics, by category. a disabled level costs one compare;
+// enabled messages are formatted by the caller, then queued to a fixed size ring
+// buffer drained by a background writer thread, so logging never waits on I/O.
+// when the ring is full, messages are dropped (and counted) rather than block
+// the search. log output goes to stderr, or to a log file; protocol (xboard)
+// replies stay on stdout...
+//******************************************************************************
+
+namespace SeaChess {
+
+enum LOG_CATEGORY { LOG_SEARCH=0, LOG_MOVEGEN, LOG_MCTS, LOG_PROTOCOL, LOG_CATEGORIES };
+
+enum LOG_LEVEL { LOG_OFF=0, LOG_ERROR, LOG_WARN, LOG_INFO, LOG_DEBUG, LOG_TRACE };
+
+#define LOG_RING_SIZE 8192  // max # of messages queued to the writer
+
+class Logger {
+public:
+  static bool Enabled(int category, int level) { return level <= levels[category]; };
+
+  static void SetLevel(int category, int level) { levels[category] = level; };
+
+  // configure levels from a string, ie, 'category:level[,category:level...]', where category is
+  // search, movegen, mcts, protocol or all. returns false if the string is invalid...
+
+  static bool Configure(std::string spec);
+
+  // start the writer thread, logging to file (stderr if no file given); stop drains the ring
+  // buffer, then waits for the writer to exit. until started, messages are written directly...
+
+  static void Start(std::string log_file = "");
+  static void Stop();
+
+  static void Write(int category, int level, const std::string &text);
+
+  static unsigned long Dropped() { return dropped; };
+
+  static const char *CategoryAsStr(int category);
+  static const char *LevelAsStr(int level);
+
+private:
+  struct Message {
+    int category;
+    int level;
+    std::string text;
+  };
+
+  static void WriterLoop();
+  static void Output(Message &message);
+
+  static int levels[LOG_CATEGORIES];    // highest level enabled, per category
+
+  static std::vector<Message> ring;     // messages queued for the writer
+  static unsigned int head;             //   next to write,
+  static unsigned int count;            //   and # queued
+  static unsigned long dropped;         // # of messages dropped, ring full
+
+  static std::mutex ring_mutex;
+  static std::condition_variable ring_ready;
+  static std::thread writer;
+  static bool running;
+  static bool stopping;
+
+  static FILE *sink;                    // log file (or stderr)
+};
+
+// engine output, ie, comments (diagnostics) and thinking output meant for the xboard client. goes
+// to stdout, or in server mode, to the connection of the session the calling thread is working
+// for. SetOutput sets the calling threads output (NULL - stdout)...
+
+std::ostream &Output();
+void SetOutput(std::ostream *out);
+
+// log a message, formatted as for an output stream, ie, LOG(LOG_MCTS,LOG_TRACE,"visits: " << visits).
+// the message is only formatted if its category and level are enabled...
+
+#define LOG(category,level,message) \
+  do { \
+    if (SeaChess::Logger::Enabled(category,level)) { \
+      std::ostringstream log_line; \
+      log_line << message; \
+      SeaChess::Logger::Write(category,level,log_line.str()); \
+    } \
+  } while(0)
+
+};
+
+#endif
+#define __LOGGER__
@@ -0,0 +1,93 @@
+#ifndef __MATE_SOLVER__
+
+#include <stdint.h>
+#include <unordered_map>
+
+//******************************************************************************
+// MateSolver - depth-first proof-number (df-pn) search for forced mate.
+//
+// the attacking side considers checking moves only, the defending side all of
+// its (legal) moves, so the tree is small even for deep mates. each position
+// has a proof number (# of positions yet to be proven to prove mate) and a
+// disproof number; the search expands the most-proving position 'til the root
+// is proven or disproven. mates are looked for in one move, then two, ... up to
+// some max; proof/disproof numbers are kept in a table, keyed by position and
+// # of plies left. the search also ends early if the engine search it precedes is
+// stopped or runs short of time (see SetSearchControl)...
+//******************************************************************************
+
+namespace SeaChess {
+
+#define MATE_SOLVER_INFINITY 100000000  // proof/disproof number of a proven/disproven position
+#define MATE_SOLVER_POLL_NODES 256       // check the search control every this many positions
+
+class MateSolver {
+public:
+  MateSolver(unsigned int _max_nodes = 200000) : max_nodes(_max_nodes), nodes(0), table_probes(0), table_hits(0),
+                                                 control(NULL), time_share(0), stopped(false), next_poll(0),
+                                                 attacking_color(WHITE), moves_engine(WHITE,1) {};
+
+  // give up if the search is stopped, past its hard limit, or has used this share (percent)
+  // of its soft limit (zero - no share)...
+
+  void SetSearchControl(SearchControl *_control, unsigned int _time_share) {
+    control = _control;
+    time_share = _time_share;
+  };
+
+  // look for a forced mate in (at most) max_moves moves, color to move. if found, returns true,
+  // along with the mating (first) move and the # of moves to mate...
+
+  bool Solve(Move &mating_move, int &mate_in, Board &board, int color, int max_moves);
+
+  unsigned int Nodes() { return nodes; };
+
+  bool NodeLimitReached() { return nodes >= max_nodes; };
+  bool Stopped() { return stopped; };
+
+  unsigned int TableProbes() { return table_probes; };
+  unsigned int TableHits()   { return table_hits; };
+
+private:
+  // phi, delta - for a position where the attacker is to move, the proof and disproof numbers
+  // respectively; for the defender, the reverse...
+
+  struct Entry {
+    unsigned int phi;
+    unsigned int delta;
+  };
+
+  bool OutOfBudget();
+
+  void MID(Board &board, uint64_t key, int color, int plies, unsigned int phi_threshold, unsigned int delta_threshold);
+
+  Entry Lookup(uint64_t key, int plies);
+  void  Store(uint64_t key, int plies, unsigned int phi, unsigned int delta);
+
+  static uint64_t TableKey(uint64_t key, int plies) { return key ^ (plies * 0x9e3779b97f4a7c15ULL); };
+
+  static unsigned int Sum(unsigned int a, unsigned int b) {
+    return (a + b >= MATE_SOLVER_INFINITY) ? MATE_SOLVER_INFINITY : a + b;
+  };
+
+  unsigned int max_nodes;      // give up once this many positions have been searched
+  unsigned int nodes;          // positions searched
+  unsigned int table_probes;   // proof numbers table lookups,
+  unsigned int table_hits;     //   and # found
+
+  SearchControl *control;      // search limits, if any
+  unsigned int time_share;     // percent of the soft limit the solver may use
+  bool stopped;                // search stopped, or out of time
+  unsigned int next_poll;      // # of nodes at which to next check the search control
+
+  int attacking_color;         // side looking to mate
+
+  MovesTree moves_engine;      // used to generate moves
+
+  std::unordered_map<uint64_t,Entry> table;
+};
+
+};
+
+#endif
+#define __MATE_SOLVER__
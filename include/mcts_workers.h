@@ -0,0 +1,142 @@
+#ifndef __MCTS_WORKERS__
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <functional>
+#include <stdint.h>
+
+#include <rollout_pool.h>
+
+//******************************************************************************
+// MctsWorkers - monte-carlo rollouts played by other processes, on this host
+// or others. the coordinator (the engine searching) runs tree selection and
+// expansion as usual; a rollout pool with workers shares each new leafs batch
+// of random games out among its own threads and its workers, in proportion to
+// their threads (the remainder in turn, so a worker gets its share even of one
+// game per leaf).
+//
+// the coordinator does not wait on a leafs games: the search goes on, and up
+// to MCTS_WORKER_PIPELINE_DEPTH batches per worker are outstanding at once (a
+// worker with a full pipeline gets no more; its share is played locally). each
+// batch comes back (scores, outcome counts, AMAF moves) as a WorkerResult,
+// tagged with its leaf, to be backed up then. workers are only waited on once
+// the search is over, or the tree is to be trimmed, and then never past the
+// search deadline (time_up).
+//
+// a worker process (sea_chess --mcts-worker <address>) serves any number of
+// coordinators, each on its own connection, with a rollout pool (of
+// --rollout-threads threads) of its own. a worker that fails, or takes longer
+// than MCTS_WORKER_TIMEOUT_MS on a batch (or to take one), is dropped; its
+// outstanding batches come back unplayed. batches still outstanding when the
+// search ends are abandoned - their replies are read, and dropped, later.
+//
+// messages (host byte order): on connecting, the worker sends WorkerHello.
+// then, for each batch: WorkerRequest, followed by history_count history
+// entries (the positions that could still recur), answered (in order) by WorkerReply,
+// followed by amaf_count AMAF moves (uint16_t, see AmafMoves::Played)...
+//******************************************************************************
+
+namespace SeaChess {
+
+#define MCTS_WORKER_MAGIC      "SEAMCTSW"
+#define MCTS_WORKER_VERSION    1
+#define MCTS_WORKER_TIMEOUT_MS 30000
+#define MCTS_WORKER_PIPELINE_DEPTH 8    // batches outstanding, per worker
+#define MCTS_WORKER_POLL_MS    10       // a wait checks the search deadline this often
+
+struct WorkerHello {
+  char     magic[8];
+  uint32_t version;
+  uint32_t threads;             // rollout threads, per coordinator
+};
+
+struct WorkerRequest {
+  uint32_t num_games;
+  int32_t  level;
+  uint32_t max_levels;
+  uint32_t turn_number;
+  uint32_t history_count;       // # of WorkerHistoryEntry that follow
+  uint8_t  color;               // to move
+  uint8_t  record_amaf;         // return the moves played?
+  uint8_t  board[BOARD_PACKED_BYTES];
+  uint8_t  unused[7];
+};
+
+struct WorkerHistoryEntry {
+  uint64_t key;
+  int32_t  halfmove_clock;
+  int32_t  window;
+};
+
+struct WorkerReply {
+  uint32_t num_games;
+  float    white_score;
+  float    black_score;
+  uint32_t num_draws;
+  uint32_t num_checkmates;
+  uint32_t num_max_levels_reached;
+  uint32_t num_bitbase_outcomes;
+  uint32_t amaf_count;          // # of AMAF moves that follow
+};
+
+class MctsWorkers {
+public:
+  // connect to workers. those that cannot be reached are reported, and left out...
+
+  MctsWorkers(std::vector<std::string> &addresses);
+  ~MctsWorkers();
+
+  int Count();      // # of workers (still) connected
+  int Threads();    //   and their threads
+
+  // post a leafs batch of games to the workers - each gets its share, the local threads keep
+  // theirs (games that do not divide evenly among the threads are handed out in turn, batch by
+  // batch, as is the share of a worker whose pipeline is full). returns the # of games posted,
+  // and sets the # of batches...
+
+  int Post(uint32_t leaf, int num_games, int local_threads, Board &board, int color, int level, unsigned int max_levels,
+           unsigned int turn_number, GameHistory &game_history, bool record_amaf, int &num_batches,
+           std::vector<WorkerResult> &results);
+
+  // results of batches that have come back (or were lost), without waiting...
+
+  void Poll(std::vector<WorkerResult> &results);
+
+  // wait on all outstanding batches, 'til time_up. those still out are then abandoned (and come
+  // back unplayed). either way, each batch posted comes back once...
+
+  void Drain(std::vector<WorkerResult> &results, std::function<bool()> &time_up);
+
+  // worker process - serve coordinators on address, 'til SIGINT or SIGTERM...
+
+  static int Serve(std::string address, int threads);
+
+private:
+  struct Batch {
+    uint32_t leaf;
+    int      num_games;
+    bool     abandoned;   // the search ended first (and the batch was reported unplayed)
+    std::chrono::steady_clock::time_point posted;
+  };
+
+  struct Worker {
+    std::string address;
+    int         fd;
+    uint32_t    threads;
+    std::deque<Batch> batches;  // posted, oldest first, yet to be replied to
+  };
+
+  bool Receive(Worker &worker, std::vector<WorkerResult> &results);
+  bool Wait(Worker &worker, std::vector<WorkerResult> &results, std::function<bool()> &time_up);
+  void Lost(Worker &worker, std::string reason, std::vector<WorkerResult> *results);
+
+  std::vector<Worker> workers;
+  int next_slot;        // the next batchs remainder games go to the threads from here on
+};
+
+};
+
+#endif
+#define __MCTS_WORKERS__
@@ -81,10 +81,10 @@ public:
   void SetOutcome(int _outcome) { outcome = _outcome; };
   void SetCheck(bool _check=true) { check = _check; };
 
-  int Score() { return score; };
+  int Score() const { return score; };
   void SetScore(int _score) {
     if ( (_score < INT_LEAST16_MIN) || (_score > INT_LEAST16_MAX) ) {
-      std::cout << INT_LEAST16_MIN << "/" << _score << "/" << INT_LEAST16_MAX << std::endl;
+      Output() << INT_LEAST16_MIN << "/" << _score << "/" << INT_LEAST16_MAX << std::endl;
     }
     assert ( (_score >= INT_LEAST16_MIN) && (_score <= INT_LEAST16_MAX) );
     score = _score;
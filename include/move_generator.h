@@ -0,0 +1,240 @@
+#ifndef __MOVE_GENERATOR__
+
+//******************************************************************************
+// MoveGenerator - moves generation, specialized at compile time for each side
+// and piece type. pawn direction, starting/promotion rows, capture targets and
+// slider directions are all resolved by the compiler, thus no virtual calls
+// and no color tests in the inner loops...
+//******************************************************************************
+
+namespace SeaChess {
+
+// side specific constants...
+
+template<COLOR Us> struct Side;
+
+template<> struct Side<WHITE> {
+  enum { Them = BLACK, Forward =  1, StartingRow = 1, PromotionRow = 7 };
+};
+
+template<> struct Side<BLACK> {
+  enum { Them = WHITE, Forward = -1, StartingRow = 6, PromotionRow = 0 };
+};
+
+class MoveGenerator {
+public:
+  // append all moves for a side (some of which may leave its king in check)...
+
+  static void GetMoves(MoveList *moves, Board &the_board, int color, bool in_check,
+		       bool kings_side_castle = true, bool queens_side_castle = true) {
+    if (color == WHITE)
+      GetMoves<WHITE>(moves,the_board,in_check,kings_side_castle,queens_side_castle);
+    else
+      GetMoves<BLACK>(moves,the_board,in_check,kings_side_castle,queens_side_castle);
+  };
+
+  template<COLOR Us> static void GetMoves(MoveList *moves, Board &the_board, bool in_check,
+					  bool kings_side_castle, bool queens_side_castle) {
+    int kings_row = 0, kings_column = 0;   // opposing kings position, used to flag moves that check
+    the_board.GetKing(kings_row,kings_column,Side<Us>::Them);
+
+    for (int row = 0; row < 8; row++) {
+       for (int column = 0; column < 8; column++) {
+          int piece_type, piece_color;
+          if ( !the_board.GetPiece(piece_type,piece_color,row,column) || (piece_color != Us) )
+	    continue;
+	  switch(piece_type) {
+	    case PAWN:   PieceMoves<Us,PAWN>(moves,the_board,row,column,kings_row,kings_column);   break;
+	    case ROOK:   PieceMoves<Us,ROOK>(moves,the_board,row,column,kings_row,kings_column);   break;
+	    case KNIGHT: PieceMoves<Us,KNIGHT>(moves,the_board,row,column,kings_row,kings_column); break;
+	    case BISHOP: PieceMoves<Us,BISHOP>(moves,the_board,row,column,kings_row,kings_column); break;
+	    case QUEEN:  PieceMoves<Us,QUEEN>(moves,the_board,row,column,kings_row,kings_column);  break;
+	    case KING:   KingMoves<Us>(moves,the_board,row,column,kings_row,kings_column,in_check,
+				       kings_side_castle,queens_side_castle);
+	                 break;
+	    default:     throw std::runtime_error("Invalid chess piece type?");
+	                 break;
+	  }
+       }
+    }
+  };
+
+private:
+  // is the move-to square free, or can a piece be captured there? if so add the move...
+
+  template<COLOR Us> static int MoveTo(MoveList *moves, Board &the_board, int row, int column, int end_row, int end_column) {
+    int other_piece_type, other_piece_color;
+
+    if (the_board.GetPiece(other_piece_type,other_piece_color,end_row,end_column)) {
+      if (other_piece_color == Us)
+	return SQUARE_BLOCKED;
+      // if king is taken, then we missed king-in-check state on previous move...
+      if (other_piece_type == KING)
+	throw std::logic_error("king is taken???");
+      moves->Add( Move(row,column,end_row,end_column,Us,CAPTURE,other_piece_type) );
+      return CAPTURE;
+    }
+
+    moves->Add( Move(row,column,end_row,end_column,Us,SIMPLE_MOVE,NONE) );
+    return SIMPLE_MOVE;
+  };
+
+  // from its move-to square, would a piece check the opposing king? the square the piece
+  // is moving from is treated as empty...
+
+  template<PIECE_TYPE Pt> static bool Checks(Board &the_board, int row, int column, int end_row, int end_column,
+					     int kings_row, int kings_column) {
+    int dr = kings_row - end_row;
+    int dc = kings_column - end_column;
+
+    if (Pt == KNIGHT)
+      return (abs(dr) == 1 && abs(dc) == 2) || (abs(dr) == 2 && abs(dc) == 1);
+
+    bool diagonal   = (dr != 0) && (abs(dr) == abs(dc));
+    bool horiz_vert = (dr == 0) != (dc == 0);
+
+    if ( !( ((Pt != ROOK) && diagonal) || ((Pt != BISHOP) && horiz_vert) ) )
+      return false;
+
+    int row_step = (dr > 0) - (dr < 0);
+    int column_step = (dc > 0) - (dc < 0);
+
+    for (int rr = end_row + row_step, cc = end_column + column_step; (rr != kings_row) || (cc != kings_column);
+	 rr += row_step, cc += column_step) {
+       if ( the_board.SquareOccupied(rr,cc) && ((rr != row) || (cc != column)) )
+	 return false; // blocked
+    }
+
+    return true;
+  };
+
+  // pawns...
+
+  template<COLOR Us> static void AddPawnMove(MoveList *moves, Board &the_board, int row, int column, int end_row,
+					     int end_column, int kings_row, int kings_column) {
+    if (end_row == Side<Us>::PromotionRow) {
+      // will ASSUME promotion to queen...
+      moves->Back().SetOutcome(PROMOTION);
+      if (Checks<QUEEN>(the_board,row,column,end_row,end_column,kings_row,kings_column))
+	moves->Back().SetCheck();
+    } else if ( (kings_row == end_row + Side<Us>::Forward) && (abs(kings_column - end_column) == 1) ) {
+      moves->Back().SetCheck();
+    }
+  };
+
+  template<COLOR Us> static void PawnMoves(MoveList *moves, Board &the_board, int row, int column,
+					   int kings_row, int kings_column) {
+    const int end_row = row + Side<Us>::Forward;
+
+    // en passant from the current position...
+
+    for (int end_column = column - 1; end_column <= column + 1; end_column += 2) {
+       if ( Board::ValidColumn(end_column) && the_board.EnPassantSet(row,end_column,Us) ) {
+	 moves->Add( Move(row,column,end_row,end_column,Us,CAPTURE,PAWN) );
+       }
+    }
+
+    // pawn can move up one row at a time. if this is the pawns starting row, then it can
+    // move two rows up as well...
+
+    if (!the_board.SquareOccupied(end_row,column)) {
+      MoveTo<Us>(moves,the_board,row,column,end_row,column);
+      AddPawnMove<Us>(moves,the_board,row,column,end_row,column,kings_row,kings_column);
+      if ( (row == Side<Us>::StartingRow) && !the_board.SquareOccupied(end_row + Side<Us>::Forward,column) ) {
+        MoveTo<Us>(moves,the_board,row,column,end_row + Side<Us>::Forward,column);
+        AddPawnMove<Us>(moves,the_board,row,column,end_row + Side<Us>::Forward,column,kings_row,kings_column);
+      }
+    }
+
+    // pawn can, from its current position, also capture on its diagonals...
+
+    for (int end_column = column - 1; end_column <= column + 1; end_column += 2) {
+       int other_piece_type, other_piece_color;
+       if ( Board::ValidColumn(end_column) && the_board.GetPiece(other_piece_type,other_piece_color,end_row,end_column)
+	    && (other_piece_color != Us) ) {
+         MoveTo<Us>(moves,the_board,row,column,end_row,end_column);
+         AddPawnMove<Us>(moves,the_board,row,column,end_row,end_column,kings_row,kings_column);
+       }
+    }
+  };
+
+  // kings - cannot move next to the opposing king; castling handled here too (the caller has
+  // checked the squares the king passes over are not attacked)...
+
+  template<COLOR Us> static void KingMoves(MoveList *moves, Board &the_board, int row, int column,
+					   int kings_row, int kings_column, bool in_check,
+					   bool kings_side_castle, bool queens_side_castle) {
+    static const int rows[] = { 1,  1,  0, -1, -1, -1,  0,  1 };
+    static const int cols[] = { 0,  1,  1,  1,  0, -1, -1, -1 };
+
+    for (int i = 0; i < 8; i++) {
+       int end_row = row + rows[i];
+       int end_column = column + cols[i];
+       if ( !Board::ValidPosition(end_row,end_column) )
+	 continue;
+       if ( (abs(kings_row - end_row) <= 1) && (abs(kings_column - end_column) <= 1) )
+	 continue;
+       MoveTo<Us>(moves,the_board,row,column,end_row,end_column);
+    }
+
+    if (in_check) {
+      // cannot castle out of check...
+    } else {
+      int end_column = 0;
+      if ( kings_side_castle && ((end_column = the_board.CastleValid(Us,true /* = kings side castling */)) != 0) )
+        MoveTo<Us>(moves,the_board,row,column,row,end_column);
+      if ( queens_side_castle && ((end_column = the_board.CastleValid(Us,false /* = queens side castling */)) != 0) )
+        MoveTo<Us>(moves,the_board,row,column,row,end_column);
+    }
+  };
+
+  // knights, bishops, rooks, queens...
+
+  template<COLOR Us, PIECE_TYPE Pt> static void PieceMoves(MoveList *moves, Board &the_board, int row, int column,
+							   int kings_row, int kings_column) {
+    if (Pt == PAWN) {
+      PawnMoves<Us>(moves,the_board,row,column,kings_row,kings_column);
+      return;
+    }
+
+    if (Pt == KNIGHT) {
+      static const int rows[] = { 2,  2,  1, -1, -2, -2,  1, -1 };
+      static const int cols[] = { 1, -1,  2,  2,  1, -1, -2, -2 };
+      for (int i = 0; i < 8; i++) {
+         int end_row = row + rows[i];
+         int end_column = column + cols[i];
+	 if ( Board::ValidPosition(end_row,end_column)
+	      && (MoveTo<Us>(moves,the_board,row,column,end_row,end_column) != SQUARE_BLOCKED)
+	      && Checks<KNIGHT>(the_board,row,column,end_row,end_column,kings_row,kings_column) )
+	   moves->Back().SetCheck();
+      }
+      return;
+    }
+
+    // sliders - bishops move diagonally, rooks horizontally or vertically, queens both ways...
+
+    static const int rows[] = { 1,  1, -1, -1,  1, -1,  0,  0 };
+    static const int cols[] = { 1, -1,  1, -1,  0,  0,  1, -1 };
+
+    const int first_direction = (Pt == ROOK)   ? 4 : 0;
+    const int last_direction  = (Pt == BISHOP) ? 4 : 8;
+
+    for (int i = first_direction; i < last_direction; i++) {
+       for (int end_row = row + rows[i], end_column = column + cols[i]; Board::ValidPosition(end_row,end_column);
+	    end_row += rows[i], end_column += cols[i]) {
+	  int move_outcome = MoveTo<Us>(moves,the_board,row,column,end_row,end_column);
+	  if (move_outcome == SQUARE_BLOCKED)
+	    break; // quit 1st time we run into some other piece, same color...
+	  if (Checks<Pt>(the_board,row,column,end_row,end_column,kings_row,kings_column))
+	    moves->Back().SetCheck();
+	  if (move_outcome == CAPTURE)
+	    break;
+       }
+    }
+  };
+};
+
+};
+
+#endif
+#define __MOVE_GENERATOR__
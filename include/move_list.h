@@ -0,0 +1,64 @@
+#ifndef __MOVE_LIST__
+
+//******************************************************************************
+// MoveList - fixed capacity list of moves. meant to be allocated on the stack
+//            (no heap allocation) and reused during move generation...
+//******************************************************************************
+
+#include <new>
+
+namespace SeaChess {
+
+#define MAX_MOVES 256 // more than the # of moves possible from any position
+
+class MoveList {
+public:
+  MoveList() : count(0) {};
+
+  // moves are copied in place; storage is NOT initialized up front...
+
+  void Add(const Move &new_move) {
+    assert(count < MAX_MOVES);
+    new (&Moves()[count]) Move(new_move);
+    count++;
+  };
+
+  Move &Back() { assert(count > 0); return Moves()[count - 1]; };
+
+  Move &operator[](int index) { return Moves()[index]; };
+
+  int  Count() { return count; };
+  bool Empty() { return count == 0; };
+  void Clear() { count = 0; };
+
+  // remove (in place) any move for which keep(move) is false. the order of remaining
+  // moves is unchanged...
+
+  template<class Predicate> void Filter(Predicate keep) {
+    int keep_count = 0;
+    for (int i = 0; i < count; i++) {
+       if (keep(Moves()[i])) {
+	 if (keep_count != i)
+	   Moves()[keep_count] = Moves()[i];
+	 keep_count++;
+       }
+    }
+    count = keep_count;
+  };
+
+  // for use with std algorithms (sort, shuffle, etc.)...
+
+  Move *begin() { return Moves(); };
+  Move *end()   { return Moves() + count; };
+
+private:
+  Move *Moves() { return reinterpret_cast<Move *>(storage); };
+
+  alignas(Move) unsigned char storage[MAX_MOVES * sizeof(Move)];
+  int count;
+};
+
+};
+
+#endif
+#define __MOVE_LIST__
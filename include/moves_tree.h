@@ -7,18 +7,29 @@
 #include <string>
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
 #include <vector>
+#include <unordered_map>
+#include <random>
 #include <algorithm>
 #include <sys/time.h>
 #include <math.h>
 
-//#define GRAPH_SUPPORT 1
+// minimax - keep the whole search tree (normally only the root moves are kept), ie, for tree
+// dumps (--tree-dump). slow, and memory hungry...
+
+//#define MINIMAX_SEARCH_TREE 1
 
 namespace SeaChess {
 
-#ifdef GRAPH_SUPPORT
-extern int master_move_id;
-#endif
+// search scores...
+
+#define MATE_SCORE         10000   // checkmate, less the # of plies to reach it
+#define MATE_BOUND         (MATE_SCORE - 1000)  // scores past this are (plies to) mate
+#define MINIMAX_DRAW_SCORE 0       // (random_moves_game.h DRAW_SCORE is a game result)
+#define INFINITE_SCORE     30000   // scores are kept within a 16 bit range
+
+#define MAX_PLY            64      // search depth limit
   
 //******************************************************************************
 // moves tree node...
@@ -26,29 +37,23 @@ extern int master_move_id;
 
 class MovesTreeNode : public Move {
 public:
-  MovesTreeNode() : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0)
+  MovesTreeNode() : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0),
+                    num_amaf_visits(0), num_amaf_wins(0.0), unexpanded_moves(NULL), unexpanded_count(0)
  {
     InitMove();
-#ifdef GRAPH_SUPPORT
-    move_id = master_move_id++;
-#endif
   };
   
   MovesTreeNode(int start_row, int start_column, int end_row, int end_column, int color,
 		int outcome = INVALID_INDEX, int capture_type = INVALID_INDEX)
-              : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0) {
+              : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0),
+                num_amaf_visits(0), num_amaf_wins(0.0), unexpanded_moves(NULL), unexpanded_count(0) {
     InitMove(start_row, start_column, end_row, end_column, color, outcome, capture_type);
-#ifdef GRAPH_SUPPORT
-    move_id = master_move_id++;
-#endif
   };
 
-  MovesTreeNode(Move move) : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0) {
+  MovesTreeNode(Move move) : possible_moves(NULL), num_node_visits(0), num_white_wins(0.0), num_black_wins(0.0),
+                             num_amaf_visits(0), num_amaf_wins(0.0), unexpanded_moves(NULL), unexpanded_count(0) {
     InitMove(move.StartRow(), move.StartColumn(), move.EndRow(), move.EndColumn(),
 	     move.Color(), move.Outcome(), move.Check(), move.CaptureType());
-#ifdef GRAPH_SUPPORT
-    move_id = master_move_id++;
-#endif
   };
   
   ~MovesTreeNode() { Flush(); };
@@ -59,14 +64,15 @@ public:
     MovesTreeNode *new_node = (MovesTreeNode *) malloc( sizeof(MovesTreeNode) );
     
     new_node->Set(&new_move);
-#ifdef GRAPH_SUPPORT
-    new_node->move_id = master_move_id++;
-#endif
     new_node->pm_count = 0;
     new_node->possible_moves = NULL;
     new_node->num_node_visits = 0;
     new_node->num_white_wins = 0.0;
     new_node->num_black_wins = 0.0;
+    new_node->num_amaf_visits = 0;
+    new_node->num_amaf_wins = 0.0;
+    new_node->unexpanded_moves = NULL;
+    new_node->unexpanded_count = 0;
     
     possible_moves = (MovesTreeNode **) realloc(possible_moves, sizeof(MovesTreeNode *) * (pm_count + 1) );
     possible_moves[pm_count] = new_node;
@@ -92,12 +98,88 @@ public:
     } else {
       assert( (pm_count == 0) && (possible_moves == NULL) );
     }
+    free(unexpanded_moves);
+    unexpanded_moves = NULL;
+    unexpanded_count = 0;
+  };
+
+  // progressive widening (monte-carlo) - a nodes moves are generated all at once, but are kept
+  // in compact form (color, start and end squares) 'til added to the tree, one at a time, in
+  // the order given...
+
+  void SetUnexpandedMoves(MoveList &moves) {
+    assert( (unexpanded_moves == NULL) && (moves.Count() <= UINT8_MAX) );
+    if (moves.Empty())
+      return;
+    unexpanded_moves = (uint16_t *) malloc( sizeof(uint16_t) * moves.Count() );
+    // (stored last to first, so as to be taken from the end)...
+    for (auto i = 0; i < moves.Count(); i++) {
+       unexpanded_moves[i] = MoveCode(moves[moves.Count() - 1 - i]);
+    }
+    unexpanded_count = moves.Count();
+  };
+
+  static uint16_t MoveCode(Move &move) {
+    return (move.Color() << 12) | ((move.StartRow() * 8 + move.StartColumn()) << 6) | (move.EndRow() * 8 + move.EndColumn());
+  };
+
+  int UnexpandedMovesCount() { return unexpanded_count; };
+
+  // memory used by this nodes subtree (the node itself not included), ie, child nodes (and
+  // pointers to same) and unexpanded moves. num_nodes is bumped by the # of nodes in the subtree...
+
+  size_t SubtreeBytes(int &num_nodes) {
+    size_t bytes = pm_count * (sizeof(MovesTreeNode) + sizeof(MovesTreeNode *)) + unexpanded_count * sizeof(uint16_t);
+    num_nodes += pm_count;
+    for (int i = 0; i < pm_count; i++) {
+       bytes += possible_moves[i]->SubtreeBytes(num_nodes);
+    }
+    return bytes;
+  };
+
+  // have this nodes moves been generated?...
+
+  bool Expanded() { return (pm_count > 0) || (unexpanded_count > 0); };
+
+  // add the next (unexpanded) move to the tree...
+
+  MovesTreeNode *ExpandMove() {
+    assert(unexpanded_count > 0);
+    int code = unexpanded_moves[--unexpanded_count];
+    if (unexpanded_count == 0) {
+      free(unexpanded_moves);
+      unexpanded_moves = NULL;
+    }
+    int start = (code >> 6) & 0x3f;
+    int end = code & 0x3f;
+    return AddMove( Move(start / 8, start % 8, end / 8, end % 8, code >> 12) );
+  };
+
+  // add a specific (unexpanded) move to the tree, out of order. returns NULL if the move is not
+  // among the unexpanded moves...
+
+  MovesTreeNode *ExpandMove(int code) {
+    for (int i = 0; i < unexpanded_count; i++) {
+       if (unexpanded_moves[i] == code) {
+         // (others keep their order; this move is taken from the end)...
+         std::rotate(unexpanded_moves + i, unexpanded_moves + i + 1, unexpanded_moves + unexpanded_count);
+         return ExpandMove();
+       }
+    }
+    return NULL;
   };
 
   friend std::ostream& operator<< (std::ostream &os, SeaChess::MovesTreeNode &fld);
   
   void Sort( bool (*sortfunction)(MovesTreeNode *m1, MovesTreeNode *m2) ) {
-    std::sort( possible_moves, possible_moves + pm_count, sortfunction );
+    std::stable_sort( possible_moves, possible_moves + pm_count, sortfunction );
+  };
+
+  // move a possible move to the head of the list, others keep their order...
+  
+  void MoveToFront(int index) {
+    assert( (index >= 0) && (index < pm_count) );
+    std::rotate( possible_moves, possible_moves + index, possible_moves + index + 1 );
   };
 
   void Randomize() {
@@ -112,7 +194,7 @@ public:
   float NumberOfBlackWins() { return num_black_wins; };
 
   void DisplayWins(const std::string &prefix) {
-    std::cout << prefix << " #visits: " << NumberOfVisits() << ", # white wins:" << NumberOfWhiteWins()
+    Output() << prefix << " #visits: " << NumberOfVisits() << ", # white wins:" << NumberOfWhiteWins()
               << ", # black wins:" << NumberOfBlackWins() << std::endl;
   };
 
@@ -144,11 +226,22 @@ public:
       num_black_wins += _black_wins;
   };
 
-#ifdef GRAPH_SUPPORT
-  int ID() { return move_id; };
-  int move_id;
-#endif
-  
+  // AMAF (all moves as first) stats - # of simulations (through the parent node) in which this
+  // move was played, at any point, by the same side, and the # of those won by that side...
+
+  int   NumberOfAmafVisits() { return num_amaf_visits; };
+  float NumberOfAmafWins()   { return num_amaf_wins; };
+
+  void IncreaseAmafCounts(float _wins) {
+    num_amaf_visits++;
+    num_amaf_wins += _wins;
+  };
+
+  void SetAmafCounts(int _visits, float _wins) {
+    num_amaf_visits = _visits;
+    num_amaf_wins = _wins;
+  };
+
 private:
   //int_least8_t pm_count;
 
@@ -156,7 +249,65 @@ private:
   float num_white_wins;              // used in monte-carlo tree simulation
   float num_black_wins;              //
 
+  int   num_amaf_visits;             // monte-carlo RAVE
+  float num_amaf_wins;               //   (wins for this moves color)
+
   MovesTreeNode **possible_moves;
+
+  uint16_t *unexpanded_moves;        // monte-carlo progressive widening - moves not yet added
+  uint8_t   unexpanded_count;        //   to the tree, compact form (see SetUnexpandedMoves)
+};
+
+//******************************************************************************
+// AMAF - the moves played (by either side) during a single monte-carlo simulation,
+// ie, moves along the tree path and in the random game that followed. a move is
+// 'in' the set if stamped with the current simulation #, so no clearing needed...
+//******************************************************************************
+
+class AmafMoves {
+public:
+  AmafMoves() : simulation(1) { memset(played,0,sizeof(played)); };
+
+  void NextSimulation() { simulation++; };
+
+  void Add(Move *move) { played[Side(move)][Code(move)] = simulation; };
+
+  bool Contains(Move *move) { return played[Side(move)][Code(move)] == simulation; };
+
+  // moves played in the current simulation, as side << 12 | from square << 6 | to square (side
+  // zero - white), and the same, added (see MctsWorkers)...
+
+  void Played(std::vector<uint16_t> &moves) {
+    for (int side = 0; side < 2; side++) {
+       for (int code = 0; code < 64 * 64; code++) {
+          if (played[side][code] == simulation)
+            moves.push_back((side << 12) | code);
+       }
+    }
+  };
+
+  void AddPlayed(uint16_t move) { played[(move >> 12) & 1][move & 0xfff] = simulation; };
+
+  // add the moves played in another sets current simulation...
+
+  void Merge(AmafMoves &src) {
+    for (int side = 0; side < 2; side++) {
+       for (int code = 0; code < 64 * 64; code++) {
+          if (src.played[side][code] == src.simulation)
+            played[side][code] = simulation;
+       }
+    }
+  };
+
+private:
+  static int Side(Move *move) { return (move->Color() == WHITE) ? 0 : 1; };
+
+  static int Code(Move *move) {
+    return ((move->StartRow() * 8 + move->StartColumn()) << 6) | (move->EndRow() * 8 + move->EndColumn());
+  };
+
+  int simulation;
+  int played[2][64 * 64];   // color x (from square, to square)
 };
 
 
@@ -164,7 +315,7 @@ struct piece_counts {
     piece_counts() : kings(0), queens(0), bishops(0),knights(0),rooks(0),pawns(0) {};
 
     void dump(const std::string &prefix) {
-      std::cout << prefix << "# kings/queens/bishops/knights/rooks/pawns: " << kings
+      Output() << prefix << "# kings/queens/bishops/knights/rooks/pawns: " << kings
       << "/" << queens << "/" << bishops << "/" << knights << "/" << rooks
       << "/" << pawns << std::endl;
     };
@@ -183,17 +334,50 @@ struct piece_counts {
 
 class MovesTree {
  public:
-  MovesTree(int _color, int _max_levels) : color(_color), max_levels(_max_levels) {
+  MovesTree(int _color, int _max_levels) : color(_color), max_levels(_max_levels), post_thinking(false), uci_thinking(false),
+                                           evaluator(NULL), control(NULL), tree_dump(NULL) {
     root_node = new MovesTreeNode;
   };
   
-  ~MovesTree() { root_node->Flush(); };
+  // (deleted through a MovesTree pointer - the derived trees destructors must run)...
+
+  virtual ~MovesTree() { delete root_node; };
 
   virtual int ChooseMove(Move *next_move, Board &game_board, Move *suggested_move = NULL) { return 0; };
-  bool GetMoves(std::vector<Move> *possible_moves, Board &game_board, int color,bool avoid_check = true);
-  bool Check(Board &board,int color);
+  // (no tree needed - random games generate moves without one)...
+
+  static bool GetMoves(MoveList *possible_moves, Board &game_board, int color,bool avoid_check = true);
+  static bool Check(Board &board,int color);
   
-  static Board MakeMove(Board &board, MovesTreeNode *pv);
+  static Board MakeMove(Board &board, Move *pv);
+
+  // positions reached in the game so far, used to detect repetitions...
+
+  void SetGameHistory(GameHistory &_game_history) { game_history = _game_history; };
+
+  // xboard 'post' - show thinking output ('ply score time nodes pv') as the search progresses...
+
+  void SetPostThinking(bool _post_thinking) { post_thinking = _post_thinking; };
+
+  // UCI - thinking output as 'info' lines...
+
+  void SetUciThinking(bool _uci_thinking) { uci_thinking = _uci_thinking; };
+
+  // stats for the last search...
+
+  SearchStats &Stats() { return stats; };
+
+  // plug-in evaluation (ie, NNUE). NULL - classic evaluation (see MaterialScore)...
+
+  void SetEvaluator(Evaluator *_evaluator) { evaluator = _evaluator; };
+
+  // time limits, stop (optional). NULL - search to depth (or move time)...
+
+  void SetSearchControl(SearchControl *_control) { control = _control; };
+
+  // append the search tree to a dump file, once the move is chosen (optional)...
+
+  void SetTreeDump(TreeDump *_tree_dump) { tree_dump = _tree_dump; };
 
  protected:
   void EvalBoard(MovesTreeNode *move, Board &current_board, int forced_score=UNKNOWN);
@@ -209,13 +393,12 @@ class MovesTree {
   int GetPieceCount(Move *node,Board &game_board,int color);
 
   int Color() { return color; };
-  int OtherColor(int current_color) { return (current_color == WHITE) ? BLACK : WHITE; };
+  static int OtherColor(int current_color) { return (current_color == WHITE) ? BLACK : WHITE; };
   int NextColor(int current_color) { return OtherColor(current_color);  };
   
   int MaxLevels() { return max_levels; };
 
-  void GraphMovesToFile(const std::string &outfile, MovesTreeNode *node);
-  void GraphMoves(std::ofstream &grfile, MovesTreeNode *node, int level);
+  void DumpTree(MovesTreeNode *root, Board &game_board, int algorithm);
 
   MovesTreeNode *root_node;
 
@@ -224,41 +407,166 @@ class MovesTree {
 
   int eval_count;
 
-  int kings_row;
-  int kings_column;
+  GameHistory game_history; // game positions, then positions along the current search path
+
+  bool post_thinking;       // xboard thinking output enabled
+  bool uci_thinking;        // UCI thinking output ('info' lines)
+
+  SearchStats stats;        // filled in as the search progresses
+
+  Evaluator *evaluator;     // plug-in evaluation, if any
 
-  Pieces pieces; // used to generate moves for each chess piece type
+  SearchControl *control;   // search limits, if any
+
+  TreeDump *tree_dump;      // search trees dumped here, if set
 };
 
 //******************************************************************************
 // minimax moves (sub)tree class...
 //******************************************************************************
 
+// minimax search state, for a single ply...
+
+struct SearchStackEntry {
+  MoveList moves;  // possible moves at this ply, sorted
+};
+
 class MovesTreeMinimax : public MovesTree {
  public:
-  MovesTreeMinimax(int _color, int _max_levels) : MovesTree(_color,_max_levels) {};
+  MovesTreeMinimax(int _color, int _max_levels) : MovesTree(_color,_max_levels),
+    null_move_pruning(false), late_move_reductions(false), futility_pruning(false),
+    null_move_cutoffs(0), null_move_verifications(0), lmr_reductions(0), lmr_researches(0),
+    futility_prunes(0), pvs_researches(0), aspiration_researches(0), bitbase_hits(0), repetition_draws(0), root_best_index(0),
+    search_stack(MAX_PLY), transposition_table(NULL), aborted(false) {};
 
   int ChooseMove(Move *next_move, Board &game_board, Move *suggested_move = NULL);
 
+  // selective search features may be enabled/disabled individually (for A/B testing)...
+  
+  void SetSelectiveSearch(bool _null_move_pruning, bool _late_move_reductions, bool _futility_pruning) {
+    null_move_pruning    = _null_move_pruning;
+    late_move_reductions = _late_move_reductions;
+    futility_pruning     = _futility_pruning;
+  };
+
+  // transposition table (optional), kept (by the engine) from one search to the next...
+
+  void SetTranspositionTable(TranspositionTable *_transposition_table) { transposition_table = _transposition_table; };
+  
  private:
 
-  void ChooseMoveInner(MovesTreeNode *current_node, Board &current_board, int current_color,
-		       int current_level, int alpha, int beta);
+  int  Search(MovesTreeNode *current_node, Board &current_board, int current_color,
+	      int current_level, int ply, int alpha, int beta, bool null_move_allowed = true);
+
+  bool NullMoveCutoff(Board &current_board, int current_color, int current_level, int ply, int beta);
+
+  void UpdatePV(int ply, Move *pm);
+  void ShowThinking(Board &game_board, int level, int score);
+  
+  void OrderMoves(MovesTreeNode *current_node, Board &current_board, int current_color);
+  void OrderMoves(MoveList &moves, Board &current_board, int current_color);
+  int  Evaluate(Board &current_board, int current_color);
+  bool QuietMove(Board &current_board, Move *pm);
+  int  NonPawnPieceCount(Board &current_board, int color);
+
+  uint64_t TableKey();
+  bool ProbeTable(int &score, TTData &table_data, int current_level, int ply, int alpha, int beta, bool pv_node);
+
+  // search stopped (time is up, or 'stop') partway through an iteration? the search control is
+  // polled every so many nodes, once the first iteration is done...
+
+  bool SearchAborted();
+  
+  bool null_move_pruning;        // skip a turn; if opponent still can't recover, prune the subtree
+  bool late_move_reductions;     // search moves late in the (sorted) moves list at reduced depth
+  bool futility_pruning;         // skip quiet moves at frontier nodes that can't reach alpha
+
+  int null_move_cutoffs;         //
+  int null_move_verifications;   // selective search
+  int lmr_reductions;            //   stats
+  int lmr_researches;            //
+  int futility_prunes;           //
+  int pvs_researches;            // null window searches that had to be repeated
+  int aspiration_researches;     // iterations that fell outside the aspiration window
+  int bitbase_hits;              // positions whose result was taken from endgame bitbases
+  int repetition_draws;          // positions scored as draws (repetition, fifty move rule)
+
+  Move pv_table[MAX_PLY][MAX_PLY];  // triangular PV table - pv_table[ply] is the best line from ply
+  int  pv_length[MAX_PLY];          //   on, pv_length[ply] is where that line ends
+  int  root_best_index;             // index of best root move, current iteration
+
+  std::vector<SearchStackEntry> search_stack; // per-ply moves lists, allocated once
+
+  TranspositionTable *transposition_table;    // search results by position (if any)
+
+  bool aborted;                     // the current iteration was cut short; its results are discarded,
+  std::vector<int> root_scores;     //   root move scores from the last completed iteration used instead
+
+  struct timeval t1;                // used to time iterations
 };
 
 //******************************************************************************
 // monte-carlo moves (sub)tree class...
 //******************************************************************************
 
+class RolloutPool;
+
+#define RAVE_EQUIVALENCE 1000   // RAVE - # of visits at which UCB1 and AMAF values are equally weighted
+
+#define WIDENING_CONSTANT 2.0   // progressive widening - a node with n visits has (at most)
+#define WIDENING_EXPONENT 0.5   //   ceil(WIDENING_CONSTANT * n^WIDENING_EXPONENT) children
+
 class MovesTreeMonteCarlo : public MovesTree {
  public:
   MovesTreeMonteCarlo(int _color, int _max_levels, int _move_time)
     : MovesTree(_color,_max_levels), move_time(_move_time), num_turns(0), total_games_count(0),
       max_games_count(-1),number_of_levels(0),max_levels(0), num_draw_outcomes(0),
-      num_checkmate_outcomes(0), num_max_levels_reached(0), max_random_game_levels(0),
-      move_root(NULL), last_level(0), temperature(1.5), rollout_index(0), rollout_count(1) {
+      num_checkmate_outcomes(0), num_max_levels_reached(0), num_bitbase_outcomes(0), max_random_game_levels(0),
+      move_root(NULL), last_level(0), temperature(1.5), rollout_index(0), rollout_count(1), rollout_pool(NULL), rave(false),
+      best_root_move(NULL), best_move_changes(0), best_move_stable_at(0), moves_generated(0), num_simulations(0), num_rollouts(0), num_remote_rollouts(0),
+      memory_budget(0), tree_nodes(0), tree_bytes(0), memory_exhausted(false), gc_count(0), subtrees_reclaimed(0),
+      resume_tree(NULL), resume_root(0), nodes_resumed(0), saved_tree(NULL), next_leaf(0) {
   };
 
+  // RAVE - blend AMAF stats into each moves UCB1 value. the AMAF weight (beta) falls off as
+  // the move is visited; beta is one half after RAVE_EQUIVALENCE visits...
+
+  void SetRave(bool _rave) { rave = _rave; };
+
+  // limit memory used by the tree, in bytes (zero - no limit). once the limit is reached, the
+  // least visited subtrees are reclaimed; if that fails, the search is ended...
+
+  void SetMemoryBudget(size_t _memory_budget) { memory_budget = _memory_budget; };
+
+  // max # of random games played per move (zero - no limit, ie, move time only)...
+
+  void SetMaxGames(int _max_games) { max_games_count = (_max_games > 0) ? _max_games : -1; };
+
+  // # of random games played from each new leaf, averaged and backed up as a single result. if
+  // a rollout pool is given, the games are played in parallel...
+
+  void SetRollouts(int _rollout_count, RolloutPool *_rollout_pool = NULL) {
+    rollout_count = (_rollout_count < 1) ? 1 : _rollout_count;
+    rollout_pool = _rollout_pool;
+  };
+
+  // resume the search from a saved tree (see Checkpoint), ie, the subtree at resume_root, the
+  // node for the position searched. saved nodes are added to the search tree only as the search
+  // reaches them...
+
+  void SetResumeTree(const CheckpointNode *_resume_tree, uint32_t _resume_root) {
+    resume_tree = _resume_tree;
+    resume_root = _resume_root;
+  };
+
+  // once the search is complete, save the tree (visited nodes only) in flat form here...
+
+  void SetSavedTree(std::vector<CheckpointNode> *_saved_tree) { saved_tree = _saved_tree; };
+
+  // UCB1 selection kernel variant (see CpuFeatures)...
+
+  static void SelectKernels(int path);
+
   int  ChooseMove(Move *next_move, Board &game_board, Move *suggested_move = NULL);
 
   void PickBestMove(MovesTreeNode *next_move, Board &game_board, Move *suggested_move, bool debug = false);
@@ -269,7 +577,7 @@ class MovesTreeMonteCarlo : public MovesTree {
   int  BumpNumberOfTurns()    { num_turns++; return num_turns; };
   int  TotalGamesCount()      { return total_games_count; };
   void ResetTotalGamesCount() { total_games_count = 0; };
-  int  BumpTotalGamesCount()  { total_games_count++; return total_games_count; };
+  int  BumpTotalGamesCount(int _increment = 1) { total_games_count += _increment; return total_games_count; };
   
   void SetLevels(int _levels) { number_of_levels = _levels; };
   int  Levels()               { return number_of_levels; };
@@ -289,7 +597,7 @@ class MovesTreeMonteCarlo : public MovesTree {
 
   int MaxGamesCount() { return max_games_count; };
   bool MaxGamesExceeded() {
-    return MaxGamesCount() > 0 ? (TotalGamesCount() > MaxGamesCount()) : false;
+    return MaxGamesCount() > 0 ? (TotalGamesCount() >= MaxGamesCount()) : false;
   };
 
   int RolloutCount() { return rollout_count; };
@@ -298,6 +606,7 @@ class MovesTreeMonteCarlo : public MovesTree {
     num_draw_outcomes = 0;
     num_checkmate_outcomes = 0;
     num_max_levels_reached = 0;
+    num_bitbase_outcomes = 0;
   };
 
   void UpdateRandomGameStats(int &_num_draws, int &_num_checkmates, int &_num_max_levels_reached) {
@@ -306,6 +615,9 @@ class MovesTreeMonteCarlo : public MovesTree {
     num_max_levels_reached += _num_max_levels_reached;
   };
 
+  void UpdateBitbaseOutcomes(int _num_bitbase_outcomes) { num_bitbase_outcomes += _num_bitbase_outcomes; };
+  int  BitbaseOutcomes() { return num_bitbase_outcomes; };
+
  void RandomGameStats(int &_num_draws, int &_num_checkmates, int &_num_max_levels_reached) {
     _num_draws = num_draw_outcomes;
     _num_checkmates = num_checkmate_outcomes;
@@ -319,17 +631,49 @@ class MovesTreeMonteCarlo : public MovesTree {
   double ElapsedTime() {
     struct timeval t2;
     gettimeofday(&t2,NULL);
-    return ((t2.tv_sec - t1.tv_sec) * 1000.0); // milliseconds part is close enough
+    return ((t2.tv_sec - t1.tv_sec) * 1000.0) + (t2.tv_usec - t1.tv_usec) / 1000.0; // in milliseconds
   };
 
   bool Timeout(unsigned int move_time_in_seconds) {
     return ElapsedTime() > (double) move_time_in_seconds * 1000.0;
   };
 
+  // search control limits (if any) replace the move time...
+
+  bool TimeUp() {
+    if (control != NULL) {
+      if (control->Stopped())
+        return true;
+      if (control->Limited())
+        return false;
+    }
+    return Timeout(move_time);
+  };
+
  private:
 
+  void ShowThinking(MovesTreeNode *root, Board &game_board);
+
   void ChooseMoveInner(MovesTreeNode *current_node, float &incr_white_wins, float &incr_black_wins, Board &current_board, int current_color);
 
+  void UpdateAmaf(MovesTreeNode *node, float incr_white_wins, float incr_black_wins, AmafMoves &moves);
+
+  void BackupWorkerResults();
+  void DrainWorkers();
+
+  void TrackBestMove(MovesTreeNode *root);
+
+  bool GenerateMoves(MovesTreeNode *node, Board &current_board, int current_color);
+  void Widen(MovesTreeNode *node);
+
+  bool MemoryBudgetExceeded() { return (memory_budget > 0) && (tree_bytes > memory_budget); };
+  void CollectGarbage(MovesTreeNode *root);
+  void Reclaim(MovesTreeNode *node, int min_visits);
+
+  void ResumeNode(MovesTreeNode *node, const CheckpointNode &saved_node);
+  void ResumeChildren(MovesTreeNode *node);
+  void SaveTree(MovesTreeNode *root);
+
   int move_time;              // in seconds
   unsigned int num_turns;     // # of turns in a game (i move, then you move...)
   int total_games_count;      // total # of games played
@@ -339,6 +683,7 @@ class MovesTreeMonteCarlo : public MovesTree {
   int num_draw_outcomes;      //
   int num_checkmate_outcomes; // random game stats
   int num_max_levels_reached; //
+  int num_bitbase_outcomes;   //
   int max_random_game_levels; // max levels to traverse in random games
   int last_level;             // deepest level explored
 
@@ -346,7 +691,57 @@ class MovesTreeMonteCarlo : public MovesTree {
   
   MovesTreeNode *move_root;
   int rollout_index;
-  int rollout_count;
+  int rollout_count;          // # of random games played from each new leaf
+  RolloutPool *rollout_pool;  // if set, worker threads to play them
+
+  bool rave;                  // use RAVE (AMAF) stats in move selection
+  AmafMoves amaf_moves;       //   moves played in the current simulation
+
+  std::mt19937 random_engine; // rollouts played here (without a rollout pool) - seeded each move
+
+  MovesTreeNode *best_root_move; // best root move (highest win average) so far,
+  int best_move_changes;      //   # of times it changed
+  int best_move_stable_at;    //   and the simulation # when it last changed
+
+  int moves_generated;        // progressive widening stat - tree nodes had all moves been added
+
+  int num_simulations;        // # of simulations (tree descents) so far,
+  int num_rollouts;           //   and # of random games played,
+  int num_remote_rollouts;    //   by worker processes
+
+  size_t memory_budget;       // max bytes used by the tree (zero if no limit)
+  int    tree_nodes;          // tree nodes,
+  size_t tree_bytes;          //   and bytes used, as the tree grows (or is trimmed)
+  bool   memory_exhausted;    // over budget, even after garbage collection
+  int    gc_count;            // garbage collection stats - # of collections,
+  int    subtrees_reclaimed;  //   # of subtrees freed
+
+  const CheckpointNode *resume_tree;  // saved tree to resume from,
+  uint32_t resume_root;               //   the root of the search within that tree,
+  std::unordered_map<MovesTreeNode *,uint32_t> resume_nodes; // search tree nodes whose (saved)
+                                                             //   children have yet to be added,
+  int nodes_resumed;                  //   and # of saved nodes added so far
+  std::vector<CheckpointNode> *saved_tree; // tree saved here, after the search
+
+  // leaves whose games are (in part) out with worker processes, by leaf #. a leaf is backed up
+  // with the average of the games played here (none, if all went to workers - in effect, a
+  // 'virtual loss'); as each worker batch comes back, the average credited along the path to
+  // the leaf is corrected. the tree is not trimmed (garbage collected) while leaves are pending...
+
+  struct PendingLeaf {
+    std::vector<MovesTreeNode *> path;  // root ... leaf
+    int   batches;                      // worker batches yet to come back
+    int   num_games;                    // games played so far,
+    float white_score;                  //   their total scores,
+    float black_score;                  //
+    float white_credited;               //   and the average credited along the path
+    float black_credited;               //
+  };
+
+  std::unordered_map<uint32_t,PendingLeaf> pending_leaves;
+  uint32_t next_leaf;
+  std::vector<MovesTreeNode *> search_path;  // root ... the node being explored
+  AmafMoves worker_amaf;                     // (a worker batchs moves, plus those of the tree below)
   
   struct timeval t1;          // used to time moves
   double elapsed_time;
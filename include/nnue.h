@@ -0,0 +1,131 @@
+#ifndef __NNUE__
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+//******************************************************************************
+// NNUE - efficiently updatable neural network evaluation.
+//
+// network: 768 inputs (piece color relative to the perspective, piece type,
+// square; squares are mirrored top to bottom for the black perspective) feed
+// a hidden layer (the accumulator) of N int16 values, once for each
+// perspective. the accumulators, side to move first, clipped to 0..127, feed
+// two 32 wide int8 layers (clipped relu), then the output. the accumulator is
+// the sum of the (int16) weights of the pieces on the board, so a move changes
+// just a few terms; it is updated incrementally as the search makes moves.
+//
+// network file (host byte order):
+//
+//   magic "SEANNUE1", hidden size N (uint32, a multiple of 32), output divisor
+//   (int32); feature weights int16[768][N], biases int16[N]; layer one weights
+//   int8[32][2N], biases int32[32]; layer two weights int8[32][32], biases
+//   int32[32]; output weights int8[32], bias int32. layer sums are shifted
+//   right six bits before clipping; the output is divided by the divisor to
+//   get centipawns. see make_nnue for a starter network.
+//
+// the layers run on AVX2, SSSE3 or scalar kernels, as chosen at startup for
+// the host CPU (see CpuFeatures)...
+//******************************************************************************
+
+namespace SeaChess {
+
+#define NNUE_MAGIC        "SEANNUE1"
+#define NNUE_FEATURES     768
+#define NNUE_MAX_HIDDEN   1024
+#define NNUE_L1           32
+#define NNUE_L2           32
+#define NNUE_WEIGHT_SHIFT 6
+#define NNUE_MAX_CHANGES  8    // more squares than this changed? then refresh the accumulator
+
+class NnueNetwork {
+public:
+  NnueNetwork() : hidden(0), output_divisor(1), output_bias(0) {};
+
+  // allocate (zeroed) network of hidden size _hidden...
+
+  void Init(int _hidden);
+
+  void Load(std::string network_file);
+  void Save(std::string network_file);
+
+  int Hidden() { return hidden; };
+
+  // input feature index, for a piece on a square, from one sides perspective...
+
+  static int Feature(int perspective, int piece_color, int piece_type, int row, int column) {
+    int relative_row = (perspective == WHITE) ? row : 7 - row;
+    return ( ((piece_color == perspective) ? 0 : 6) + piece_type - 1 ) * 64 + relative_row * 8 + column;
+  };
+
+  // kernels variant (see CpuFeatures) - select, name of the one in use...
+
+  static void SelectKernels(int path);
+  static const char *Kernels();
+
+  int hidden;
+  int32_t output_divisor;
+
+  std::vector<int16_t> feature_weights;  // [feature][hidden]
+  std::vector<int16_t> feature_biases;   // [hidden]
+  std::vector<int8_t>  l1_weights;       // [NNUE_L1][2 * hidden]
+  std::vector<int32_t> l1_biases;
+  std::vector<int8_t>  l2_weights;       // [NNUE_L2][NNUE_L1]
+  std::vector<int32_t> l2_biases;
+  std::vector<int8_t>  output_weights;   // [NNUE_L2]
+  int32_t output_bias;
+};
+
+//******************************************************************************
+// NnueEvaluator - keeps one accumulator (per perspective) for each ply of the
+// search, updated from the ply before as moves are pushed. a position one move
+// from the current one (as when moves are ordered) is evaluated from the
+// current accumulator plus the difference, without being pushed...
+//******************************************************************************
+
+class NnueEvaluator : public Evaluator {
+public:
+  NnueEvaluator(std::shared_ptr<NnueNetwork> _network);
+
+  const char *Name() { return "nnue"; };
+
+  void SetRoot(Board &board);
+  void Push(Board &board, Board &updated_board);
+  void Pop();
+  int  Evaluate(Board &board, int color);
+
+  long Evaluations() { return evaluations; };
+  long Updates() { return updates; };
+  long Refreshes() { return refreshes; };
+
+private:
+  struct Change {
+    int row;
+    int column;
+    int old_contents;  // color << 4 | piece type, zero if none
+    int new_contents;
+  };
+
+  int16_t *Accumulator(int index, int perspective) { return &accumulators[(index * 2 + perspective - WHITE) * hidden]; };
+
+  void Refresh(int16_t *white_accumulator, int16_t *black_accumulator, Board &board);
+  bool Update(int16_t *white_accumulator, int16_t *black_accumulator, int from_index, Board &board);
+  int  Output(int16_t *stm_accumulator, int16_t *other_accumulator);
+
+  std::shared_ptr<NnueNetwork> network;
+  int hidden;
+
+  std::vector<Board>   boards;        // position at each ply of the search, and
+  std::vector<int16_t> accumulators;  //   its accumulators (the last two are scratch)
+  int ply;
+
+  long evaluations;
+  long updates;
+  long refreshes;
+};
+
+};
+
+#endif
+#define __NNUE__
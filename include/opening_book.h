@@ -0,0 +1,93 @@
+#ifndef __OPENING_BOOK__
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+//******************************************************************************
+// OpeningBook - Polyglot (.bin) format opening book, memory mapped.
+//
+// a book is a sorted (by position key) array of 16 byte big-endian entries:
+//
+//   key (8 bytes), move (2 bytes), weight (2 bytes), learn (4 bytes)
+//
+// move encoding - bits 0..2 'to' file, 3..5 'to' row, 6..8 'from' file,
+// 9..11 'from' row, 12..14 promotion piece. castling is encoded as king
+// 'captures' own rook, ie, e1h1 (not e1g1).
+//******************************************************************************
+
+namespace SeaChess {
+
+struct BookMove {
+  BookMove(int _start_row, int _start_column, int _end_row, int _end_column, int _weight)
+    : start_row(_start_row), start_column(_start_column), end_row(_end_row), end_column(_end_column),
+      weight(_weight) {};
+
+  int start_row;
+  int start_column;
+  int end_row;
+  int end_column;
+  int weight;
+};
+
+class OpeningBook {
+public:
+  OpeningBook() : book_data(NULL), book_size(0) {};
+  OpeningBook(const OpeningBook &) = delete;  // the book mapping is not shared
+  ~OpeningBook() { Close(); };
+
+  // map/unmap book file...
+
+  void Open(std::string book_file);
+  void Close();
+
+  bool IsOpen() { return book_data != NULL; };
+
+  int NumberOfEntries() { return book_size / ENTRY_SIZE; };
+
+  // all book moves for a position, ie, board and side to move...
+
+  int Moves(std::vector<BookMove> &book_moves, Board &board, int color);
+
+  // choose book move for a position - weighted random choice. return false if position not in book...
+
+  bool ChooseMove(Move &book_move, Board &board, int color);
+
+  // encode/decode polyglot moves. castling moves are translated...
+
+  static uint16_t EncodeMove(Board &board, int start_row, int start_column, int end_row, int end_column);
+  static bool DecodeMove(int &start_row, int &start_column, int &end_row, int &end_column, Board &board,
+                         uint16_t book_move);
+
+  enum { ENTRY_SIZE = 16 };
+
+  // write book entry (big-endian) to buffer...
+
+  static void PutEntry(unsigned char *entry, uint64_t key, uint16_t move, uint16_t weight, uint32_t learn = 0);
+
+private:
+  // big-endian fields from book entry...
+
+  uint64_t EntryKey(int index)    { return Unpack(book_data + index * ENTRY_SIZE, 8);      };
+  uint16_t EntryMove(int index)   { return Unpack(book_data + index * ENTRY_SIZE + 8, 2);  };
+  uint16_t EntryWeight(int index) { return Unpack(book_data + index * ENTRY_SIZE + 10, 2); };
+
+  static uint64_t Unpack(const unsigned char *bytes, int count) {
+    uint64_t value = 0;
+    for (int i = 0; i < count; i++)
+       value = (value << 8) | bytes[i];
+    return value;
+  };
+
+  // index of 1st entry with key (or NumberOfEntries() if there is none)...
+
+  int FirstEntry(uint64_t key);
+
+  const unsigned char *book_data;   // the mapped book file
+  size_t book_size;                 //   and its size in bytes
+};
+
+};
+
+#endif
+#define __OPENING_BOOK__
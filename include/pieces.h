@@ -6,7 +6,8 @@
 namespace SeaChess {
 
 //*****************************************************************************
-// chess piece, pieces...
+// chess piece, pieces. used for piece names/icons and to test for check; moves
+// are generated by the MoveGenerator class...
 //*****************************************************************************
 
 class Board;
@@ -21,16 +22,6 @@ public:
   
   virtual std::string Name() { return "?"; };
   
-  void AddPossibleMove(std::vector<Move> *moves, int start_row, int start_column, int end_row, int end_column, int color,
-                       int outcome = UNKNOWN, int capture_type = NONE);
-
-  // Moves - for a specified piece/board-position, what valid moves are possible?
-
-  void SetSpeculativeMode(bool _speculative_mode=false ) { speculative_mode = _speculative_mode; };
-  bool SpeculativeMode() { return speculative_mode; };
-  
-  virtual void Moves(std::vector<Move> *moves, Board &the_board, int color, int row, int column, bool in_check) {};
-
   virtual std::string Icon() { return "?"; };
 
   virtual bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column) { return false; };
@@ -41,33 +32,15 @@ public:
   };
 
 protected:  
-  int EvalMoveTo(std::vector<Move> *moves, Board &the_board, int color, int current_row, int current_column, int moveto_row,
-		 int moveto_column, bool can_capture = true, bool must_capture = false, bool en_passant = false);
-
-  // bishop and queen can move diagonally (king too, but will 'special case' the king)...
+  // bishop and queen check diagonally (king too, but will 'special case' the king)...
   
-  void MovesDiagonal(std::vector<Move> *moves, Board &the_board, int color, int row, int column);
   bool ChecksDiagonal(Board &the_board,int kings_row,int kings_column,int color,int row,int column);
   
-  // rook and queen can move horizontally or vertically...
+  // rook and queen check horizontally or vertically...
   
-  void MovesHorizVert(std::vector<Move> *moves, Board &the_board, int color, int row, int column);
   bool ChecksHorizVert(Board &the_board,int kings_row,int kings_column,int color,int row,int column);
 
-  // helper method for 'Diagonal'/'HorizVert' methods above:
-  bool MovesDhvHelper(std::vector<Move> *moves, int checks_direction, Board &the_board, int color, int row, int column, int end_row, int end_column);
-
-  bool KingsPosition(bool &blocked, Board &the_board, int color, int row, int column);
-
-  bool ChecksOnColumn(Board &the_board, int color, int row, int column);
-  bool ChecksOnRow(Board &the_board, int color, int row, int column);
-  bool ChecksOnRightDiagonal(Board &the_board,int color,int row,int column);
-  bool ChecksOnLeftDiagonal(Board &the_board,int color,int row,int column);
-
   friend std::ostream& operator<< (std::ostream &os, Piece &fld);
-  
-private:
-  bool speculative_mode;
 };
 
 //***************************************************************************************
@@ -78,12 +51,8 @@ public:
   Pawn() {};
   int Type() { return PAWN; };
   std::string Name() { return "pawn"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check = false);
   std::string Icon() { return "P"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);
-private:
-  bool CheckOnPromotion(Board &the_board, int row, int column, int color);
-  void EvalBlocksCastling(std::vector<Move> *moves, Board &the_board, int color, int row, int column);
 };
 
 class Rook : public Piece {
@@ -91,7 +60,6 @@ public:
   Rook() {};
   int Type() { return ROOK; };
   std::string Name() { return "rook"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check = false);
   std::string Icon() { return "R"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);  
 };
@@ -101,7 +69,6 @@ public:
   Knight() {};
   int Type() { return KNIGHT; };
   std::string Name() { return "knight"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check = false);
   std::string Icon() { return "N"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);  
 };
@@ -111,34 +78,22 @@ public:
   Bishop() {};
   int Type() { return BISHOP; };
   std::string Name() { return "bishop"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check = false);
   std::string Icon() { return "B"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);  
 };
 
 class King : public Piece {
 public:
-  King() : castling_enabled(true) {};
+  King() {};
   int Type() { return KING; };
   std::string Name() { return "king"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check);
   std::string Icon() { return "K"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);
-  
-  void SetCastlingEnabled(bool _castling_enabled) { castling_enabled = _castling_enabled; };
-  bool CastlingEnabled() { return castling_enabled; };
-  
-private:
-  bool MoveCausesCheck(Board &the_board, int kings_row, int kings_column, int color);
-
-  int opponents_king_row;
-  int opponents_king_column;
 
+private:
   enum { NUM_MOVES=8 };
   const int rows[NUM_MOVES] = { 1,  1,  0, -1, -1, -1,  0,  1 };
   const int cols[NUM_MOVES] = { 0,  1,  1,  1,  0, -1, -1, -1 };
-
-  bool castling_enabled;
 };
 
 class Queen : public Piece {
@@ -146,7 +101,6 @@ public:
   Queen() {};
   int Type() { return QUEEN; };
   std::string Name() { return "queen"; };
-  void Moves(std::vector<Move> *moves, Board &the_board, int color, int board_row, int board_column, bool in_check = false);
   std::string Icon() { return "Q"; };
   bool Check(Board &the_board, int kings_row, int kings_column, int color, int row, int column);  
 };
@@ -160,22 +114,6 @@ class Pieces {
 public:
   Pieces() {};
 
-  void GetMoves(std::vector<Move> *moves, Board &game_board, int type, int color, int row, int column, bool in_check, bool castling_enabled = true) {
-
-    switch(type) {
-      case PAWN:   pawn.Moves(moves,game_board,color,row,column,in_check);   break;
-      case ROOK:   rook.Moves(moves,game_board,color,row,column,in_check);   break;
-      case KNIGHT: knight.Moves(moves,game_board,color,row,column,in_check); break;
-      case BISHOP: bishop.Moves(moves,game_board,color,row,column,in_check); break;
-      case QUEEN:  queen.Moves(moves,game_board,color,row,column,in_check);  break;
-      case KING:   king.SetCastlingEnabled(castling_enabled);
-	           king.Moves(moves,game_board,color,row,column,in_check);   break;
-	
-      default:     throw std::runtime_error("Invalid chess piece type?");
-                   break;
-    }
-  };
-  
   bool Check(Board &game_board, int kings_row, int kings_column, int type, int color, int row, int column) {
     bool in_check = false;
     switch(type) {
@@ -0,0 +1,175 @@
+#ifndef __PROFILER__
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <stdint.h>
+
+//******************************************************************************
+// Profiler - scoped timers and counters on the search hot paths (move
+// generation, check tests, make move, evaluation, monte-carlo selection and
+// random games). built in only if SEA_CHESS_PROFILE is defined (cmake
+// -DSEA_CHESS_PROFILE=ON); otherwise PROFILE_SCOPE, PROFILE_COUNT expand to
+// nothing, and no profiling code is left in the engine.
+//
+// each thread keeps its own totals (no locks); they
+// are summed when the engine reports on a move. a scopes time is counted
+// both as 'total' (inclusive) and 'self' (less the time of the scopes nested
+// within it). time is read from the cpu timestamp counter (x86), else the
+// steady clock, and converted to nanoseconds when reported.
+//
+// optionally, each timed scope is also recorded as a Chrome trace event
+// (--profile-trace <file>; load in chrome://tracing or ui.perfetto.dev). the
+// first PROFILE_TRACE_MAX_EVENTS events per thread are kept per engine move;
+// the rest are counted as dropped. the totals are always complete...
+//******************************************************************************
+
+namespace SeaChess {
+
+enum PROFILE_SECTIONS { PROFILE_GET_MOVES=0, PROFILE_CHECK, PROFILE_MAKE_MOVE, PROFILE_EVAL_BOARD,
+                        PROFILE_HIGH_SCORE_MOVE, PROFILE_RANDOM_GAME, NUM_PROFILE_SECTIONS };
+
+enum PROFILE_COUNTERS { PROFILE_MOVES_GENERATED=0, PROFILE_RANDOM_GAME_MOVES, NUM_PROFILE_COUNTERS };
+
+#define PROFILE_TRACE_MAX_EVENTS (1 << 16)
+
+#ifdef SEA_CHESS_PROFILE
+
+// totals, summed over all threads...
+
+struct ProfileTotals {
+  ProfileTotals();
+
+  uint64_t ticks[NUM_PROFILE_SECTIONS];       // inclusive
+  uint64_t self_ticks[NUM_PROFILE_SECTIONS];  // exclusive
+  uint64_t calls[NUM_PROFILE_SECTIONS];
+  uint64_t counts[NUM_PROFILE_COUNTERS];
+};
+
+struct ProfileThread;
+
+class Profiler {
+public:
+  // start profiling; trace events are written to trace_file (if not empty)...
+
+  static void Start(std::string trace_file);
+  static void Stop();
+
+  static void Totals(ProfileTotals &totals);
+
+  // report on an engine move - each sections share of the time since 'before' was taken, and
+  // write out trace events (if tracing)...
+
+  static void ReportMove(ProfileTotals &before, double search_ms);
+
+  static const char *SectionName(int section);
+  static const char *CounterName(int counter);
+
+  static inline uint64_t Ticks();
+
+  static inline ProfileThread *Thread();   // this threads totals (registered on first use)
+
+  static bool tracing;
+
+private:
+  static ProfileThread *RegisterThread();
+};
+
+extern thread_local ProfileThread *profile_thread;
+
+struct ProfileScope;
+
+struct ProfileThread {
+  std::atomic<uint64_t> ticks[NUM_PROFILE_SECTIONS];   // written by the owning thread only,
+  std::atomic<uint64_t> self_ticks[NUM_PROFILE_SECTIONS];  //   read (relaxed) by any
+  std::atomic<uint64_t> calls[NUM_PROFILE_SECTIONS];
+  std::atomic<uint64_t> counts[NUM_PROFILE_COUNTERS];
+
+  ProfileScope *current;        // innermost open scope
+  int thread_id;                // (trace events)
+  bool in_use;                  // false once its thread exits; reused by the next new thread
+
+  struct TraceRecord {
+    uint64_t start;
+    uint64_t duration;
+    int      section;
+  };
+
+  std::mutex trace_mutex;       // (trace events are taken by whichever thread reports the move)
+  std::vector<TraceRecord> trace_events;
+  uint64_t trace_dropped;
+
+  void TraceEvent(int section, uint64_t start, uint64_t duration) {
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    if (trace_events.size() < PROFILE_TRACE_MAX_EVENTS)
+      trace_events.push_back( TraceRecord { start, duration, section } );
+    else
+      trace_dropped++;
+  };
+
+  static void Add(std::atomic<uint64_t> &value, uint64_t amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount,std::memory_order_relaxed);
+  };
+};
+
+#ifdef CPU_FEATURES_X86
+inline uint64_t Profiler::Ticks() { return __builtin_ia32_rdtsc(); }
+#else
+inline uint64_t Profiler::Ticks() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+inline ProfileThread *Profiler::Thread() {
+  return (profile_thread != NULL) ? profile_thread : RegisterThread();
+}
+
+struct ProfileScope {
+  ProfileScope(int _section) : section(_section), child_ticks(0) {
+    thread = Profiler::Thread();
+    parent = thread->current;
+    thread->current = this;
+    start = Profiler::Ticks();
+  };
+
+  ~ProfileScope() {
+    uint64_t elapsed = Profiler::Ticks() - start;
+    ProfileThread::Add(thread->ticks[section],elapsed);
+    ProfileThread::Add(thread->self_ticks[section],elapsed - child_ticks);
+    ProfileThread::Add(thread->calls[section],1);
+    if (parent != NULL)
+      parent->child_ticks += elapsed;
+    thread->current = parent;
+    if (Profiler::tracing)
+      thread->TraceEvent(section,start,elapsed);
+  };
+
+  int section;
+  uint64_t start;
+  uint64_t child_ticks;         // time in scopes nested within this one
+  ProfileScope *parent;
+  ProfileThread *thread;
+};
+
+#define PROFILE_CONCAT_(a,b) a##b
+#define PROFILE_CONCAT(a,b)  PROFILE_CONCAT_(a,b)
+
+#define PROFILE_SCOPE(section) SeaChess::ProfileScope PROFILE_CONCAT(profile_scope_,__LINE__)(section)
+#define PROFILE_COUNT(counter,amount) \
+  SeaChess::ProfileThread::Add(SeaChess::Profiler::Thread()->counts[counter],(amount))
+#define PROFILE_STOP() SeaChess::Profiler::Stop()
+
+#else
+
+#define PROFILE_SCOPE(section)
+#define PROFILE_COUNT(counter,amount)
+#define PROFILE_STOP()
+
+#endif
+
+};
+
+#endif
+#define __PROFILER__
@@ -1,10 +1,14 @@
 #ifndef __PROGRAM_OPTIONS__
 #include <string>
+#include <vector>
 
 // cmdline options...
 
 struct ProgramOptions {
-    ProgramOptions() : num_levels(0), max_levels(3), is_white(false),move_time(20) {};
+    ProgramOptions() : num_levels(0), max_levels(3), is_white(false),move_time(20),
+      null_move_pruning(true), late_move_reductions(true), futility_pruning(true), book_depth(16),
+      bitbases(true), rave(false), mcts_mem(0), mcts_games(0), rollouts(1), rollout_threads(1),
+      mate_search(4), search_threads(1), max_sessions(256), tt_mem(0), tt_clear(false), cpu_kernels("auto") {};
 
     bool parse_cmdline_options(int argc, char **argv);
 
@@ -18,6 +22,34 @@ struct ProgramOptions {
     bool is_white;
     unsigned int move_time;  // time allowed to make a move, in seconds (monte-carlo only)
     std::string algorithm;   // which algorithm to use
+    bool null_move_pruning;     // 
+    bool late_move_reductions;  // minimax selective search features
+    bool futility_pruning;      //
+    std::string book_file;      // polyglot (.bin) opening book
+    unsigned int book_depth;    // max # of (engine) moves to take from opening book
+    bool bitbases;              // use endgame bitbases (KPK, KRK, KQK)
+    std::string bitbases_file;  //   cached in this file
+    bool rave;                  // RAVE move selection (monte-carlo only)
+    unsigned int mcts_mem;      // tree memory budget in MB, zero if no limit (monte-carlo only)
+    unsigned int mcts_games;    // max random games per move, zero if no limit (monte-carlo only)
+    unsigned int rollouts;         // random games per new leaf,
+    unsigned int rollout_threads;  //   and threads to play them (monte-carlo only)
+    unsigned int mate_search;   // look for forced mate in up to this # of moves (zero - don't)
+    std::string stats_file;     // append search stats (JSON) to this file
+    std::string tree_dump_file; // write search trees (see TreeDump) to this file
+    std::string profile_trace_file;  // write profile trace events (profiling builds) to this file
+    std::string log_file;       // diagnostics (see Logger) go to this file, or stderr
+    std::string server_address;    // serve sessions on this socket path (or localhost port),
+    unsigned int search_threads;   //   searching on this # of threads,
+    unsigned int max_sessions;     //   with at most this many sessions at once (zero - no limit)
+    std::string connect_address;   // play via a server, at this socket path (or localhost port)
+    unsigned int tt_mem;        // transposition table size in MB, zero if none (minimax only),
+    std::string tt_shared;      //   shared memory segment name (if shared with other processes),
+    bool tt_clear;              //   empty it at startup
+    std::string nnue_file;      // evaluate with this (NNUE) network, rather than material (minimax only)
+    std::string cpu_kernels;    // kernels variant: auto (best the host supports), avx2, ssse3, scalar
+    std::string mcts_worker_address;             // serve monte-carlo rollouts (worker process) on this socket
+    std::vector<std::string> mcts_workers;       // share monte-carlo rollouts out to these worker processes
 };
 
 #endif
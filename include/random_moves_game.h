@@ -1,10 +1,13 @@
 #ifndef __RANDOM_GAME__
 
+#include <random>
+
 #include <chess.h>
 
 //***********************************************************************************************
 // play a single random game of chess to conclusion or until max-levels reached
-// (in which case a draw).
+// (in which case a draw). moves are drawn from the random engine given - one per
+// rollout thread, so that threads do not share (the locked) rand()...
 //***********************************************************************************************
 
 #define WIN_SCORE  1.0
@@ -17,9 +20,12 @@ namespace SeaChess {
   
 class RandomMovesGame {
   public:
-    RandomMovesGame(unsigned int _max_levels, unsigned int _turn_number = TURNS_THRESHHOLD) 
-          : max_levels(_max_levels), turn_number(_turn_number),
-            white_score(0.0), black_score(0.0),num_draw_outcomes(0), num_checkmate_outcomes(0), num_max_levels_reached(0) { 
+    RandomMovesGame(unsigned int _max_levels, std::mt19937 &_random_engine, unsigned int _turn_number = TURNS_THRESHHOLD,
+                    GameHistory *_game_history = NULL, AmafMoves *_amaf_moves = NULL) 
+          : max_levels(_max_levels), turn_number(_turn_number), random_engine(_random_engine), game_history(_game_history),
+            amaf_moves(_amaf_moves),
+            white_score(0.0), black_score(0.0),num_draw_outcomes(0), num_checkmate_outcomes(0), num_max_levels_reached(0),
+            num_bitbase_outcomes(0) { 
     };
 
     ~RandomMovesGame() {
@@ -27,7 +33,7 @@ class RandomMovesGame {
 
     void Play(float &_white_score, float &_black_score, Board &_current_board, int _current_color, int _current_level);
 
-    void PlayInner(MovesTreeNode *_current_node, Board &_current_board, int _current_color);
+    void PlayInner(Board &_current_board, int _current_color);
 
     void PredictOutcome(Board &current_board, int current_color);
 
@@ -43,7 +49,11 @@ class RandomMovesGame {
       _num_max_levels_reached = num_max_levels_reached;
     };
 
+    int BitbaseOutcomes() { return num_bitbase_outcomes; };
+
     bool KingsDraw(Board &current_board);
+    bool RepetitionDraw();
+    bool BitbaseOutcome(Board &current_board, int current_color);
     bool LevelsMaxedOut();
     void GameEnds(bool in_check, int other_color);
 
@@ -54,12 +64,18 @@ class RandomMovesGame {
     unsigned int max_levels;        // maximum # of levels to play before draw
     unsigned int turn_number;       // if turn# < play threshhold, return statistical outcome instead of actual play
 
+    std::mt19937 &random_engine;    // moves are shuffled with this
+
+    GameHistory *game_history;      // positions reached (if known), used to detect repetitions
+    AmafMoves   *amaf_moves;        // if set, record moves played (monte-carlo RAVE)
+
     float        white_score;       // scores
     float        black_score;       //   after game concludes
 
     int num_draw_outcomes;          // # of random games that ended in draw
     int num_checkmate_outcomes;     //       "                "        checkmate
     int num_max_levels_reached;     //       "                "     when max-levels reached
+    int num_bitbase_outcomes;       //       "                "     as per endgame bitbases
 };
 
 };
@@ -0,0 +1,159 @@
+#ifndef __ROLLOUT_POOL__
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <string>
+#include <functional>
+#include <random>
+
+#include <chess.h>
+#include <random_moves_game.h>
+
+//******************************************************************************
+// RolloutPool - persistent pool of worker threads for (leaf parallel) monte-carlo
+// rollouts. a batch of random games, all played from the same (newly expanded)
+// leaf, is shared out among the workers; the caller plays its share too, then
+// waits for the batch to complete. the pool is created once, and kept from move
+// to move. games shared out to worker processes (see MctsWorkers) are not
+// waited on; their results come back later, as WorkerResults...
+//******************************************************************************
+
+namespace SeaChess {
+
+// results summed over a batch of random games...
+
+struct RolloutTotals {
+  RolloutTotals() { Clear(); };
+
+  void Clear() {
+    num_games = 0;
+    white_score = 0.0;
+    black_score = 0.0;
+    num_draws = 0;
+    num_checkmates = 0;
+    num_max_levels_reached = 0;
+    num_bitbase_outcomes = 0;
+    num_remote_games = 0;
+  };
+
+  void Add(RandomMovesGame &game, float _white_score, float _black_score) {
+    int _num_draws, _num_checkmates, _num_max_levels_reached;
+    game.RandomGameStats(_num_draws, _num_checkmates, _num_max_levels_reached);
+    num_games++;
+    white_score += _white_score;
+    black_score += _black_score;
+    num_draws += _num_draws;
+    num_checkmates += _num_checkmates;
+    num_max_levels_reached += _num_max_levels_reached;
+    num_bitbase_outcomes += game.BitbaseOutcomes();
+  };
+
+  void Add(RolloutTotals &src) {
+    num_games += src.num_games;
+    white_score += src.white_score;
+    black_score += src.black_score;
+    num_draws += src.num_draws;
+    num_checkmates += src.num_checkmates;
+    num_max_levels_reached += src.num_max_levels_reached;
+    num_bitbase_outcomes += src.num_bitbase_outcomes;
+    num_remote_games += src.num_remote_games;
+  };
+
+  int   num_games;
+  float white_score;
+  float black_score;
+  int   num_draws;
+  int   num_checkmates;
+  int   num_max_levels_reached;
+  int   num_bitbase_outcomes;
+  int   num_remote_games;        // of num_games, played by workers (see MctsWorkers)
+};
+
+// a batch of a leafs games, played (or not) by a worker process...
+
+struct WorkerResult {
+  uint32_t              leaf;        // as posted (see RolloutPool::PlayShared)
+  int                   num_games;   // # of games posted
+  RolloutTotals         totals;      // those played (none if the worker was lost, or the batch abandoned)
+  std::vector<uint16_t> amaf;        // the moves played (see AmafMoves::Played), if asked for
+};
+
+class MctsWorkers;
+
+class RolloutPool {
+public:
+  // the pool may also share batches out to worker processes (see MctsWorkers), at these addresses...
+
+  RolloutPool(int num_threads, std::vector<std::string> worker_addresses = std::vector<std::string>());
+  ~RolloutPool();
+
+  int NumberOfThreads() { return slots.size(); };
+  int NumberOfWorkers();
+
+  // play num_games random games from board, color to move, at some level of the tree, on the pools
+  // threads. game_history holds the positions reached so far; if amaf_moves is set, the moves
+  // played are added to it...
+
+  void Play(RolloutTotals &totals, int num_games, Board &board, int color, int level, unsigned int max_levels,
+            unsigned int turn_number, GameHistory &game_history, AmafMoves *amaf_moves = NULL);
+
+  // as Play, but the worker processes (if any) get a share of the games, which is not waited on.
+  // totals are for the games played here. returns the # of worker batches posted for this leaf;
+  // each comes back once (see Results), played or not...
+
+  int PlayShared(uint32_t leaf, RolloutTotals &totals, int num_games, Board &board, int color, int level,
+                 unsigned int max_levels, unsigned int turn_number, GameHistory &game_history, AmafMoves *amaf_moves);
+
+  // wait on the batches still out with workers, 'til time_up; the rest are abandoned...
+
+  void Drain(std::function<bool()> time_up);
+
+  // worker batches come back so far (the list is emptied)...
+
+  void Results(std::vector<WorkerResult> &results);
+
+private:
+  void WorkerLoop(int slot_index);
+  void PlayGames(int slot_index);
+
+  // per thread state (slot zero is the callers)...
+
+  struct Slot {
+    RolloutTotals totals;
+    GameHistory   game_history;
+    AmafMoves     amaf_moves;
+    std::mt19937  random_engine;   // seeded (from rand) as the pool starts
+  };
+
+  std::vector<Slot>        slots;
+  std::vector<std::thread> workers;
+
+  std::mutex              pool_mutex;
+  std::condition_variable batch_ready;   // signaled when a batch is posted (or on shutdown)
+  std::condition_variable batch_done;    //    "      when the last worker finishes a batch
+  int  batch_id;                         // bumped as each batch is posted
+  int  workers_busy;                     // # of workers yet to finish the current batch
+  bool shutdown;
+
+  // the current batch...
+
+  std::atomic<int> next_game;
+  int              num_games;
+  Board            board;
+  int              color;
+  int              level;
+  unsigned int     max_levels;
+  unsigned int     turn_number;
+  bool             record_amaf;
+
+  MctsWorkers     *remote_workers;      // worker processes (if any),
+  std::vector<WorkerResult> remote_results;  //   and their batches come back
+};
+
+};
+
+#endif
+#define __ROLLOUT_POOL__
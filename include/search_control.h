@@ -0,0 +1,97 @@
+#ifndef __SEARCH_CONTROL__
+
+#include <atomic>
+#include <chrono>
+#include <stdint.h>
+
+//******************************************************************************
+// SearchControl - limits on an engine search (UCI 'go'), and the means to end
+// it early ('stop'), from another thread. the moves trees poll it as they
+// search.
+//
+// time limits are in milliseconds, counted from Start (or, when pondering,
+// from PonderHit): past the soft limit no new (minimax) iteration is begun;
+// past the hard limit the search stops. no limits - the search runs to its
+// depth (or move time) as usual. infinite (and pondering) - the search runs
+// 'til stopped...
+//******************************************************************************
+
+namespace SeaChess {
+
+class SearchControl {
+public:
+  SearchControl() : stop(false), ponder(false), infinite(false), soft_ms(0), hard_ms(0), start_us(0) {};
+
+  // a new search, with these limits (zero - none)...
+
+  void Start(long _soft_ms, long _hard_ms, bool _infinite, bool _ponder) {
+    soft_ms = _soft_ms;
+    hard_ms = _hard_ms;
+    infinite = _infinite;
+    ponder = _ponder;
+    start_us = NowMicroseconds();
+    stop = false;
+  };
+
+  // end the search now (the best move so far is played)...
+
+  void Stop() { stop = true; };
+
+  // the move pondered on was played - the clock starts now...
+
+  void PonderHit() {
+    start_us = NowMicroseconds();
+    ponder = false;
+  };
+
+  // is the search governed by time (or by stop) rather than by depth or move time?...
+
+  bool Limited() { return infinite || ponder || (hard_ms > 0); };
+
+  // search should end now...
+
+  bool Stopped() {
+    if (stop)
+      return true;
+    if (ponder || infinite || (hard_ms == 0))
+      return false;
+    return ElapsedMs() >= hard_ms;
+  };
+
+  // ok to begin another iteration?...
+
+  bool NextIteration() {
+    if (Stopped())
+      return false;
+    if (ponder || infinite || (soft_ms == 0))
+      return true;
+    return ElapsedMs() < soft_ms;
+  };
+
+  // has the search used this share (percent) of its soft limit? (never, if no soft limit)...
+
+  bool SoftLimitUsed(unsigned int percent) {
+    if (ponder || infinite || (soft_ms == 0))
+      return false;
+    return ElapsedMs() * 100 >= soft_ms * (long) percent;
+  };
+
+  long ElapsedMs() { return (long) ((NowMicroseconds() - start_us) / 1000); };
+
+private:
+  static int64_t NowMicroseconds() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  };
+
+  std::atomic<bool>    stop;
+  std::atomic<bool>    ponder;
+  std::atomic<bool>    infinite;
+  std::atomic<long>    soft_ms;
+  std::atomic<long>    hard_ms;
+  std::atomic<int64_t> start_us;
+};
+
+};
+
+#endif
+#define __SEARCH_CONTROL__
@@ -0,0 +1,53 @@
+#ifndef __SEARCH_STATS__
+
+#include <string>
+
+//******************************************************************************
+// SearchStats - statistics for a single search (ie, engine move), filled in
+// by the moves tree (and mate solver) used, reported by the engine as a one
+// line JSON summary...
+//******************************************************************************
+
+namespace SeaChess {
+
+struct SearchStats {
+  SearchStats() : score(0), depth(0), seldepth(0), nodes(0), time_ms(0.0), cutoffs(0), rollouts(0), remote_rollouts(0),
+                  tree_nodes(0), tree_bytes(0), mate_nodes(0), mate_time_ms(0.0), mate_tt_probes(0),
+                  mate_tt_hits(0), tt_probes(0), tt_hits(0), tt_cutoffs(0) {};
+
+  double NodesPerSecond()    { return (time_ms > 0.0) ? nodes * 1000.0 / time_ms : 0.0; };
+  double RolloutsPerSecond() { return (time_ms > 0.0) ? rollouts * 1000.0 / time_ms : 0.0; };
+
+  std::string Json();
+
+  // UCI 'info' line - depth, score (from the side to move; centipawns, or moves to mate), nodes,
+  // time, pv...
+
+  std::string UciInfo();
+
+  std::string algorithm;   // minimax, monte-carlo, random, or mate-solver (forced mate found)
+  std::string move;        // move chosen (if any)
+  int    score;            // centipawns, engines point of view (monte-carlo - from win rate)
+  int    depth;            // minimax - last iteration completed; monte-carlo - deepest tree level
+  int    seldepth;         // deepest ply searched
+  long   nodes;            // positions searched (monte-carlo - simulations)
+  double time_ms;          // search time
+  long   cutoffs;          // minimax beta cutoffs
+  long   rollouts;         // monte-carlo random games,
+  long   remote_rollouts;  //   of which played by worker processes
+  long   tree_nodes;       // monte-carlo tree size,
+  long   tree_bytes;       //   at the end of the search
+  long   mate_nodes;       // mate solver (run before the search) positions searched,
+  double mate_time_ms;     //   time,
+  long   mate_tt_probes;   //   and proof numbers table
+  long   mate_tt_hits;     //   probes, hits
+  long   tt_probes;        // minimax transposition table probes,
+  long   tt_hits;          //   hits,
+  long   tt_cutoffs;       //   and hits that ended the search of a position
+  std::string pv;          // principal variation (moves, space separated), as last reported
+};
+
+};
+
+#endif
+#define __SEARCH_STATS__
@@ -0,0 +1,29 @@
+#ifndef __SOCKET_ADDRESS__
+
+#include <string>
+
+//******************************************************************************
+// socket addresses, as given on the command line (server mode, monte-carlo
+// workers):
+//
+//   <port>       - TCP, localhost
+//   <host:port>  - TCP, some host (listening - on that interface; 0.0.0.0 for
+//                  all of them)
+//   <path>       - Unix domain socket
+//******************************************************************************
+
+namespace SeaChess {
+
+// is the address a Unix domain socket path?...
+
+bool IsSocketPath(std::string address);
+
+// open a (stream) socket - listening on the address, or connected to it. throws logic_error if
+// that fails...
+
+int OpenSocket(std::string address, bool listening);
+
+};
+
+#endif
+#define __SOCKET_ADDRESS__
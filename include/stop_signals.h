@@ -0,0 +1,46 @@
+#ifndef __STOP_SIGNALS__
+
+#include <signal.h>
+
+//******************************************************************************
+// StopSignals - servers (server mode, monte-carlo workers) stop on SIGINT or
+// SIGTERM. the signals are blocked in every thread, so that no thread can take
+// one (and leave the accepting thread blocked), and are read instead by the
+// accepting thread, from a signalfd polled along with the listening socket.
+//
+// a thread started before the server (the log writer) blocks them itself
+// (BlockStopSignals); threads started by the server inherit its mask...
+//******************************************************************************
+
+namespace SeaChess {
+
+// block SIGINT, SIGTERM in the calling thread (and so in threads it starts from then on). the
+// mask as it was is returned, if asked for...
+
+void BlockStopSignals(sigset_t *previous = NULL);
+
+class StopSignals {
+public:
+  // block the stop signals in this thread (start the servers threads after), open the signalfd.
+  // throws logic_error if that fails...
+
+  StopSignals();
+  ~StopSignals();  // close the signalfd, restore the mask
+
+  // wait for a connection on listen_fd, or a stop signal. returns the connection, else -1:
+  // either Stopped(), or accept failed (errno says why)...
+
+  int Accept(int listen_fd);
+
+  bool Stopped() { return stopped; };
+
+private:
+  int      signal_fd;
+  bool     stopped;
+  sigset_t previous_mask;
+};
+
+};
+
+#endif
+#define __STOP_SIGNALS__
@@ -0,0 +1,150 @@
+#ifndef __STREAM_PLAYER__
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <atomic>
+#include <iostream>
+
+//******************************************************************************
+// StreamPlayer - drives an engine from xboard (or UCI) commands read from an
+// input stream; replies are written to an output stream. usually the streams
+// are stdin/stdout, ie, xboard starts one engine process per game. in server
+// mode each session is a socket connection, and many sessions (games) share
+// one process, ie, one copy of bitbases, opening book, etc.
+//
+// the protocol is set by the first command: 'uci' - UCI, else xboard...
+//******************************************************************************
+
+namespace StreamPlayer {
+
+class SearchPool;
+
+class Session {
+public:
+  Session(SeaChess::Engine *_engine, std::istream &_in, std::ostream &_out, SearchPool *_search_pool = NULL)
+    : engine(_engine), in(_in), out(_out), search_pool(_search_pool), position_valid(false), side_to_move(SeaChess::WHITE),
+      hold_bestmove(false), infinite_search(false), uci_debug(false) {};
+  ~Session();
+
+  // play 'til quit (or end of input). if the engine throws, the reader is left running 'til
+  // input ends...
+
+  int Play();
+
+private:
+  int PlayXboard();
+  int PlayUci();
+
+  void Reader();
+  std::string NextToken();
+  std::string PeekToken();
+  void ToXboard(std::string tbuf);
+
+  // UCI - commands are one per line; a search runs on its own thread, so that commands (stop,
+  // ponderhit, isready) are handled while it runs...
+
+  std::vector<std::string> NextLine();
+  void UciPosition(std::vector<std::string> &command);
+  void UciGo(std::vector<std::string> &command);
+  void UciSearch();
+  void UciStop();
+  void UciWrite(std::string line);
+  void UciOutput(std::string line);
+
+  // engine makes its next move, on the search pool if there is one...
+
+  std::string EngineMove();
+
+  SeaChess::Engine *engine;
+  std::istream &in;
+  std::ostream &out;
+  SearchPool *search_pool;
+
+  // a separate thread accumulates 'tokens' from xboard, so the engine is never blocked waiting
+  // on input...
+
+  std::thread             reader_thread;
+  std::mutex              reader_mutex; // controls access to tokens queue
+  std::queue<std::string> tokens;       // tokens (non-blank char strings) from xboard, an empty
+                                        //   string marks the end of each line
+  std::condition_variable token_cond;   // signaled as each line of tokens is queued
+
+  // UCI state...
+
+  std::vector<std::string> position_moves;  // moves made on the engines board, from the start position
+  bool                     position_valid;  //   (false - position could not be set up)
+  int                      side_to_move;
+
+  std::thread             search_thread;   // search in progress (or done, not yet joined)
+  std::exception_ptr      search_error;    //   exception thrown by it, if any
+  std::mutex              uci_mutex;       // controls access to hold_bestmove
+  std::condition_variable bestmove_cond;   // signaled when hold_bestmove is cleared
+  bool                    hold_bestmove;   // infinite, or pondering - bestmove waits on stop (or ponderhit)
+  bool                    infinite_search;
+
+  std::mutex              out_mutex;       // engine output, replies are written a line at a time
+  std::atomic<bool>       uci_debug;       // UCI 'debug on' - engine comments are sent as 'info string'
+};
+
+//******************************************************************************
+// SearchPool - engine searches from all sessions are run on a fixed # of
+// threads, in the order submitted. a session waits on its search...
+//******************************************************************************
+
+class SearchPool {
+public:
+  SearchPool(unsigned int num_threads);
+  ~SearchPool();
+
+  // run search on a pool thread, with output going to out. returns once the search is done;
+  // an exception thrown by the search is rethrown here...
+
+  void Run(std::function<void()> search, std::ostream &out);
+
+  unsigned int Threads() { return workers.size(); };
+
+private:
+  struct Job {
+    std::function<void()> search;
+    std::ostream *out;
+    bool done;
+    std::exception_ptr error;
+  };
+
+  void Worker();
+
+  std::mutex pool_mutex;
+  std::condition_variable job_ready;  // signaled as each job is queued,
+  std::condition_variable job_done;   //   and as each job completes
+  std::queue<Job *> jobs;
+  std::vector<std::thread> workers;
+  bool stopping;
+};
+
+// play one game on stdin/stdout...
+
+int Play(SeaChess::Engine *engine);
+
+// server - accept sessions on a Unix domain socket (address is a path) or on a localhost TCP
+// port (address is a number). each session gets its own engine, from new_engine. runs 'til
+// SIGINT or SIGTERM...
+
+typedef std::function<SeaChess::Engine *()> EngineFactory;
+
+int Serve(std::string address, unsigned int search_threads, unsigned int max_sessions, EngineFactory new_engine);
+
+// client - relay stdin/stdout to/from a server session, ie, so that xboard can play on a
+// server...
+
+int Connect(std::string address);
+
+};
+
+#endif
+#define __STREAM_PLAYER__
@@ -0,0 +1,125 @@
+#ifndef __TRANSPOSITION_TABLE__
+
+#include <string>
+#include <atomic>
+#include <stdint.h>
+
+//******************************************************************************
+// TranspositionTable - minimax search results by position (zobrist key), kept
+// in process memory, or in a named shared memory segment so that engine
+// processes on the same host reuse each others searches.
+//
+// entries are updated without locks: each entry is two 64 bit words, the data
+// and the key xor'd with the data. a probe that reads one word from one store
+// and the other from another (or a torn entry) fails the key check, and is a
+// miss. entries are grouped in buckets of four (one cache line).
+//
+// aging - the table generation is advanced at the start of each search. when a
+// bucket is full, the entry replaced is the one with the lowest depth, less
+// eight levels per generation of age. entries from old searches are still
+// used (if not yet replaced). --tt-clear empties the table at startup...
+//******************************************************************************
+
+namespace SeaChess {
+
+class Move;
+
+#define TT_MAGIC          "SEATTABL"
+#define TT_VERSION        1
+#define TT_BUCKET_ENTRIES 4
+#define TT_AGE_WEIGHT     8    // a generation of age counts as this many levels of depth
+#define TT_GENERATIONS    64   // generation is kept in six bits
+#define TT_DEFAULT_MB     64   // table size, if shared but no size given
+
+enum TT_BOUND { TT_NONE=0, TT_EXACT, TT_LOWER, TT_UPPER };
+
+// entry data, unpacked...
+
+struct TTData {
+  int  score;        // from the point of view of the side to move (mate scores relative to the position)
+  int  depth;        // levels searched below the position
+  int  bound;        // TT_EXACT, TT_LOWER (score is at least this), TT_UPPER (at most)
+  int  generation;
+  int  start_square; // best move (if any), as row * 8 + column,
+  int  end_square;   //   zero for both if no move
+
+  bool HasMove() { return start_square != end_square; };
+};
+
+class TranspositionTable {
+public:
+  TranspositionTable() : header(NULL), buckets(NULL), num_buckets(0), mapping(NULL), mapping_bytes(0),
+                         shared(false), huge_pages("none") {};
+  TranspositionTable(const TranspositionTable &) = delete;
+  ~TranspositionTable() { Close(); };
+
+  // allocate a table of (about) size_mb megabytes, rounded down to a power of two # of buckets. if
+  // shared_name is given, the table is a shared memory segment of that name, created if need be, else
+  // mapped as is (its size is set by whichever process created it)...
+
+  void Open(unsigned int size_mb, std::string shared_name = "");
+  void Close();
+
+  bool IsOpen() { return buckets != NULL; };
+  bool Shared() { return shared; };
+
+  size_t SizeBytes() { return num_buckets * sizeof(Bucket); };
+  size_t NumberOfEntries() { return num_buckets * TT_BUCKET_ENTRIES; };
+
+  const char *HugePages() { return huge_pages; };
+
+  // start of a search - advance the generation...
+
+  void NewSearch();
+
+  // empty the table...
+
+  void Clear();
+
+  bool Probe(uint64_t key, TTData &data);
+  void Store(uint64_t key, int depth, int bound, int score, Move *best_move);
+
+  // entries stored by the current search (or since), per mille, from a sample of buckets...
+
+  int Usage();
+
+private:
+  struct Entry {
+    std::atomic<uint64_t> check;  // key ^ data
+    std::atomic<uint64_t> data;
+  };
+
+  struct Bucket {
+    Entry entries[TT_BUCKET_ENTRIES];
+  };
+
+  struct Header {
+    char                  magic[8];
+    uint32_t              version;
+    uint32_t              entry_bytes;
+    uint64_t              num_buckets;
+    std::atomic<uint32_t> ready;       // set once the creator has filled in the header
+    std::atomic<uint32_t> generation;
+    char                  unused[32];  // buckets start on a cache line
+  };
+
+  static uint64_t Pack(int depth, int bound, int score, int generation, Move *best_move);
+  static TTData Unpack(uint64_t data);
+
+  void *Map(size_t bytes, int fd);
+
+  Header  *header;
+  Bucket  *buckets;
+  uint64_t num_buckets;
+
+  void  *mapping;
+  size_t mapping_bytes;
+
+  bool shared;
+  const char *huge_pages;   // hugetlb, transparent, or none
+};
+
+};
+
+#endif
+#define __TRANSPOSITION_TABLE__
@@ -0,0 +1,100 @@
+#ifndef __TREE_DUMP__
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <stdio.h>
+#include <stdint.h>
+
+//******************************************************************************
+// TreeDump - search trees, written (appended) to a file after each search, for
+// offline inspection (see tree_export). nodes are streamed out depth first, in
+// pre-order, from a small fixed buffer; the tree is not copied, and no more
+// memory is used than a stack as deep as the tree. a nodes parent is the
+// nearest node before it that is one level shallower.
+//
+// layout: for each search, TreeDumpHeader followed by node_count nodes. the
+// node count is filled in once the tree is written; zero - an incomplete dump.
+// multi-byte values are in host byte order...
+//******************************************************************************
+
+namespace SeaChess {
+
+class MovesTreeNode;
+class Board;
+
+#define TREE_DUMP_MAGIC   "SEATREED"
+#define TREE_DUMP_VERSION 1
+
+#define TREE_DUMP_MINIMAX     0   // (TreeDumpHeader algorithm)
+#define TREE_DUMP_MONTE_CARLO 1
+
+#define TREE_DUMP_BUFFER_NODES 4096
+
+struct TreeDumpHeader {
+  char     magic[8];
+  uint32_t version;
+  uint32_t header_bytes;      // sizeof(TreeDumpHeader)
+  uint32_t node_bytes;        // sizeof(TreeDumpNode)
+  uint32_t game_ply;          // plies played in the game, at the root
+  uint64_t node_count;
+  uint8_t  color;             // to move, at the root
+  uint8_t  algorithm;
+  uint8_t  board[BOARD_PACKED_BYTES];  // root position
+  uint8_t  unused[3];
+};
+
+struct TreeDumpNode {
+  uint16_t move;              // color << 12 | start square << 6 | end square (root: zero)
+  uint16_t depth;             // plies below the root
+  uint16_t num_children;
+  uint8_t  outcome;
+  uint8_t  unused;
+  uint32_t visits;            // monte-carlo
+  float    white_wins;        //
+  float    black_wins;        //
+  int32_t  score;             // minimax
+};
+
+class TreeDump {
+public:
+  TreeDump() : dump_file(NULL), num_trees(0), node_count(0), write_failed(false) {};
+  ~TreeDump() { Close(); };
+
+  // open (create or truncate) dump file. throws logic_error if that fails...
+
+  void Open(std::string file);
+  void Close();
+
+  // append a search tree. safe to call from several engines (server mode) at once; their
+  // trees are written one after another. returns the # of nodes written...
+
+  uint64_t Write(MovesTreeNode *root, Board &board, int color, int game_ply, int algorithm);
+
+  std::string File() { return dump_file_name; };
+
+private:
+  struct Frame {
+    MovesTreeNode *node;
+    int next_child;           // next of its children to be written
+  };
+
+  void Add(MovesTreeNode *node, int depth, bool is_root);
+  void FlushBuffer();
+
+  std::mutex dump_mutex;
+
+  FILE *dump_file;
+  std::string dump_file_name;
+  unsigned int num_trees;     // written so far
+
+  std::vector<TreeDumpNode> buffer;
+  std::vector<Frame> stack;
+  uint64_t node_count;        // nodes written, current tree
+  bool write_failed;
+};
+
+};
+
+#endif
+#define __TREE_DUMP__
@@ -0,0 +1,50 @@
+#ifndef __ZOBRIST__
+
+#include <stdint.h>
+
+//******************************************************************************
+// Zobrist - 64 bit position hash keys.
+//
+// keys are laid out as per the Polyglot opening book format, ie, 781 random
+// numbers: 12 x 64 piece/square keys, then four castling rights keys, eight
+// en passant file keys and a 'white to move' key. the random numbers are those
+// of the Polyglot spec, so keys match books built by other tools...
+//******************************************************************************
+
+namespace SeaChess {
+
+class Board;
+class Move;
+
+class Zobrist {
+public:
+  // hash key for a board position, given the side to move...
+
+  static uint64_t Key(Board &board, int color_to_move);
+
+  // key for the position after a move, given the key for the position before the move...
+
+  static uint64_t Update(uint64_t key, Board &before, Board &after, Move *move, int color_to_move);
+
+  // offsets into the table of random numbers...
+
+  enum { PIECE_KEYS = 0, CASTLE_KEYS = 768, EN_PASSANT_KEYS = 772, TURN_KEY = 780, NUM_KEYS = 781 };
+
+  // polyglot 'kind of piece' - black pawn = 0, white pawn = 1, black knight = 2, ..., white king = 11...
+
+  static int PieceKind(int piece_type, int color);
+
+  static uint64_t Random64(int index) { return random64[index]; };
+
+private:
+  static uint64_t SquareKey(Board &board, int row, int column);
+  static uint64_t CastleKey(Board &board);
+  static uint64_t EnPassantKey(Board &board, int color_to_move);
+
+  static const uint64_t random64[NUM_KEYS];
+};
+
+};
+
+#endif
+#define __ZOBRIST__